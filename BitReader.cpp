@@ -0,0 +1,168 @@
+// -----------------------------------------------------------------------------
+// BitReader.cpp                                                   BitReader.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref BitReader class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include "BitReader.h"
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// ---------
+// BitReader
+// ---------
+/*
+ *
+ */
+BitReader::BitReader(const string& data)
+: m_data(data),
+  m_position(0),
+  m_failed(false)
+{
+  // nothing
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// ----
+// read
+// ----
+/*
+ *
+ */
+uint64_t BitReader::read(unsigned bits)
+{
+  // the number read
+  uint64_t value = 0;
+
+  while (bits > 0)
+  {
+    // end of data
+    if (m_position / 8 >= m_data.size())
+    {
+      m_failed = true;
+      return 0;
+    }
+
+    // the bits left in the current byte
+    unsigned left  = 8 - (m_position % 8);
+    unsigned count = (bits < left) ? bits : left;
+
+    // get bits
+    unsigned byte = static_cast<unsigned char>(m_data[m_position / 8]);
+    value = (value << count) | ((byte >> (left - count)) & ((1u << count) - 1));
+
+    m_position += count;
+    bits       -= count;
+  }
+
+  // return number
+  return value;
+}
+
+// ----------
+// readSigned
+// ----------
+/*
+ *
+ */
+int64_t BitReader::readSigned(unsigned bits)
+{
+  // nothing to read
+  if (bits == 0) return 0;
+
+  // get raw bits
+  uint64_t value = read(bits);
+
+  // extend sign
+  if ( (bits < 64) && (value >> (bits - 1)) ) value |= ~uint64_t(0) << bits;
+
+  return static_cast<int64_t>(value);
+}
+
+// ---------
+// readUnary
+// ---------
+/*
+ *
+ */
+uint64_t BitReader::readUnary()
+{
+  // the number of zeros
+  uint64_t zeros = 0;
+
+  while ( (read(1) == 0) && !m_failed )
+  {
+    zeros++;
+  }
+
+  return zeros;
+}
+
+// --------
+// readRice
+// --------
+/*
+ *
+ */
+int64_t BitReader::readRice(unsigned parameter)
+{
+  // get folded residual
+  uint64_t folded = (readUnary() << parameter) | read(parameter);
+
+  // unfold residual
+  return (folded & 1) ? -static_cast<int64_t>(folded >> 1) - 1 : static_cast<int64_t>(folded >> 1);
+}
+
+// -----
+// align
+// -----
+/*
+ *
+ */
+void BitReader::align()
+{
+  m_position = (m_position + 7) / 8 * 8;
+}
+
+
+// -----------------------------------------------------------------------------
+// Status information                                         Status information
+// -----------------------------------------------------------------------------
+
+// --------
+// position
+// --------
+/*
+ *
+ */
+size_t BitReader::position() const
+{
+  return m_position;
+}
+
+// ------
+// failed
+// ------
+/*
+ *
+ */
+bool BitReader::failed() const
+{
+  return m_failed;
+}
+
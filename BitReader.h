@@ -0,0 +1,143 @@
+// -----------------------------------------------------------------------------
+// BitReader.h                                                       BitReader.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref BitReader class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef BITREADER_H_INCLUDE_NO1
+#define BITREADER_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <string>
+#include <cstdint>
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// ---------
+// BitReader
+// ---------
+/**
+ * @brief  This class reads numbers of any width from a string of bytes
+ *         (most significant bit first).
+ *
+ * Reading behind the end yields zeros and sets the failed flag.
+ */
+class BitReader
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // ---------
+  // BitReader
+  // ---------
+  /**
+   * @brief  The standard-constructor.
+   */
+  BitReader(const string& data);
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // ----
+  // read
+  // ----
+  /**
+   * @brief  This method reads an unsigned number (up to 64 bits).
+   */
+  uint64_t read(unsigned bits);
+
+  // ----------
+  // readSigned
+  // ----------
+  /**
+   * @brief  This method reads a two's complement number (up to 64 bits).
+   */
+  int64_t readSigned(unsigned bits);
+
+  // ---------
+  // readUnary
+  // ---------
+  /**
+   * @brief  This method counts the zeros in front of the next one.
+   */
+  uint64_t readUnary();
+
+  // --------
+  // readRice
+  // --------
+  /**
+   * @brief  This method reads a rice coded residual.
+   */
+  int64_t readRice(unsigned parameter);
+
+  // -----
+  // align
+  // -----
+  /**
+   * @brief  This method skips the rest of the current byte.
+   */
+  void align();
+
+
+  // ---------------------------------------------------------------------------
+  // Status information                                       Status information
+  // ---------------------------------------------------------------------------
+
+  // --------
+  // position
+  // --------
+  /**
+   * @brief  This method returns the number of bits read.
+   */
+  size_t position() const;
+
+  // ------
+  // failed
+  // ------
+  /**
+   * @brief  This method returns true if the end of data has been passed.
+   */
+  bool failed() const;
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the bytes to read
+  const string& m_data;
+
+  /// the number of bits read
+  size_t m_position;
+
+  /// the end of data has been passed
+  bool m_failed;
+
+};
+
+#endif  /* #ifndef BITREADER_H_INCLUDE_NO1 */
+
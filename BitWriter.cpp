@@ -0,0 +1,140 @@
+// -----------------------------------------------------------------------------
+// BitWriter.cpp                                                   BitWriter.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref BitWriter class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include "BitWriter.h"
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// ---------
+// BitWriter
+// ---------
+/*
+ *
+ */
+BitWriter::BitWriter()
+: m_bits(0),
+  m_count(0)
+{
+  // nothing
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// -----
+// write
+// -----
+/*
+ * at most 7 bits remain pending, so up to 56 bits fit at once
+ */
+void BitWriter::write(uint64_t value, unsigned bits)
+{
+  // split wide numbers
+  if (bits > 32)
+  {
+    write(value >> 32, bits - 32);
+    bits = 32;
+  }
+
+  // append bits
+  m_bits   = (m_bits << bits) | (value & ((uint64_t(1) << bits) - 1));
+  m_count += bits;
+
+  // move complete bytes
+  while (m_count >= 8)
+  {
+    m_count -= 8;
+    m_data  += static_cast<char>( (m_bits >> m_count) & 0xFF );
+  }
+}
+
+// ----------
+// writeUnary
+// ----------
+/*
+ *
+ */
+void BitWriter::writeUnary(uint64_t zeros)
+{
+  // whole words of zeros
+  for(; zeros >= 32; zeros -= 32)
+  {
+    write(0, 32);
+  }
+
+  // remaining zeros and the stop bit
+  write(1, zeros + 1);
+}
+
+// ---------
+// writeRice
+// ---------
+/*
+ * the residual is folded to an unsigned number (0, -1, 1, -2, ...)
+ */
+void BitWriter::writeRice(int64_t value, unsigned parameter)
+{
+  // fold residual
+  uint64_t folded = (value < 0) ? ((uint64_t(-(value + 1)) << 1) | 1) : (uint64_t(value) << 1);
+
+  // quotient and remainder
+  writeUnary(folded >> parameter);
+  if (parameter > 0) write(folded, parameter);
+}
+
+// -----
+// align
+// -----
+/*
+ *
+ */
+void BitWriter::align()
+{
+  if (m_count > 0) write(0, 8 - m_count);
+}
+
+// -----
+// clear
+// -----
+/*
+ *
+ */
+void BitWriter::clear()
+{
+  m_data.clear();
+  m_bits  = 0;
+  m_count = 0;
+}
+
+
+// -----------------------------------------------------------------------------
+// Status information                                         Status information
+// -----------------------------------------------------------------------------
+
+// ----
+// data
+// ----
+/*
+ *
+ */
+const string& BitWriter::data() const
+{
+  return m_data;
+}
+
@@ -0,0 +1,133 @@
+// -----------------------------------------------------------------------------
+// BitWriter.h                                                       BitWriter.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref BitWriter class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef BITWRITER_H_INCLUDE_NO1
+#define BITWRITER_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <string>
+#include <cstdint>
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// ---------
+// BitWriter
+// ---------
+/**
+ * @brief  This class appends numbers of any width to a string of bytes
+ *         (most significant bit first).
+ */
+class BitWriter
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // ---------
+  // BitWriter
+  // ---------
+  /**
+   * @brief  The standard-constructor.
+   */
+  BitWriter();
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // -----
+  // write
+  // -----
+  /**
+   * @brief  This method appends the lowest bits of the given number.
+   */
+  void write(uint64_t value, unsigned bits);
+
+  // ----------
+  // writeUnary
+  // ----------
+  /**
+   * @brief  This method appends the given number of zeros and a one.
+   */
+  void writeUnary(uint64_t zeros);
+
+  // ---------
+  // writeRice
+  // ---------
+  /**
+   * @brief  This method appends the rice code of the given residual.
+   */
+  void writeRice(int64_t value, unsigned parameter);
+
+  // -----
+  // align
+  // -----
+  /**
+   * @brief  This method fills the last byte with zeros.
+   */
+  void align();
+
+  // -----
+  // clear
+  // -----
+  /**
+   * @brief  This method removes all bits.
+   */
+  void clear();
+
+
+  // ---------------------------------------------------------------------------
+  // Status information                                       Status information
+  // ---------------------------------------------------------------------------
+
+  // ----
+  // data
+  // ----
+  /**
+   * @brief  This method returns the complete bytes.
+   */
+  const string& data() const;
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the complete bytes
+  string m_data;
+
+  /// the pending bits
+  uint64_t m_bits;
+
+  /// the number of pending bits
+  unsigned m_count;
+
+};
+
+#endif  /* #ifndef BITWRITER_H_INCLUDE_NO1 */
+
@@ -0,0 +1,548 @@
+// -----------------------------------------------------------------------------
+// CatalogHandler.cpp                                         CatalogHandler.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref CatalogHandler class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "MD5.h"
+#include "message.h"
+#include "keyinfo.h"
+#include "OutputSink.h"
+#include "CatalogHandler.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------------------------------------------------------------------------
+// Helper functions                                             Helper functions
+// -----------------------------------------------------------------------------
+
+/// the first line of a catalog (change it whenever the tracks change)
+static const string catalogHeader = "# ripgen catalog 1";
+
+// ------
+// escape
+// ------
+/*
+ * backslash, tab, line break and equals sign are escaped by a backslash
+ */
+static void escape(const string& text, string& out)
+{
+  for(string::size_type i = 0; i < text.size(); i++)
+  {
+    if      (text[i] == '\\') out += "\\\\";
+    else if (text[i] == '\t') out += "\\t";
+    else if (text[i] == '\n') out += "\\n";
+    else if (text[i] == '=')  out += "\\=";
+    else                      out += text[i];
+  }
+}
+
+// ----------
+// fileDigest
+// ----------
+/*
+ * the MD5 digest of the given file (hex)
+ */
+static bool fileDigest(const string& filename, string& digest)
+{
+  // open file
+  ifstream file(filename.c_str(), ios::in | ios::binary);
+  if ( !file ) return false;
+
+  // hash file
+  MD5 md5;
+  char buffer[65536];
+  while ( file.read(buffer, sizeof(buffer)) || (file.gcount() > 0) )
+  {
+    md5.update(buffer, file.gcount());
+  }
+
+  // read error
+  if ( file.bad() ) return false;
+
+  // get hex digits
+  static const char hex[] = "0123456789abcdef";
+  string bytes = md5.digest();
+
+  digest = "";
+  for(string::size_type i = 0; i < bytes.size(); i++)
+  {
+    digest += hex[ static_cast<unsigned char>(bytes[i]) >> 4  ];
+    digest += hex[ static_cast<unsigned char>(bytes[i]) & 15 ];
+  }
+
+  // signalize success
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// --------------
+// CatalogHandler
+// --------------
+/*
+ *
+ */
+CatalogHandler::CatalogHandler(KVHandler* next)
+: ChainHandler(next),
+  m_modified(false),
+  m_stamped(false)
+{
+  // initialization
+}
+
+
+// -----------------------------------------------------------------------------
+// Callback handler                                             Callback handler
+// -----------------------------------------------------------------------------
+
+// --------------
+// OnBeginParsing
+// --------------
+/*
+ *
+ */
+void CatalogHandler::OnBeginParsing(const string& filename)
+{
+  // set current filename
+  m_filename = filename;
+
+  // empty buffers
+  m_track.clear();
+  m_current.tracks.clear();
+
+  // the state of the file
+  struct stat info;
+
+  // stamp file (names with line breaks can't be recorded)
+  m_stamped = (filename.find('\n') == string::npos)
+           && (stat(filename.c_str(), &info) == 0)
+           && fileDigest(filename, m_current.digest);
+
+  if (m_stamped)
+  {
+    m_current.size = info.st_size;
+    m_current.sec  = info.st_mtim.tv_sec;
+    m_current.nsec = info.st_mtim.tv_nsec;
+    m_current.seen = true;
+  }
+
+  // send message
+  ChainHandler::OnBeginParsing(filename);
+}
+
+// ------------
+// OnEndParsing
+// ------------
+/*
+ *
+ */
+void CatalogHandler::OnEndParsing(bool healthy)
+{
+  // send message
+  ChainHandler::OnEndParsing(healthy);
+
+  // record file
+  if ( m_stamped && healthy && this->healthy() )
+  {
+    m_entries[m_filename] = m_current;
+    m_modified = true;
+  }
+
+  // reset filename
+  m_filename = "";
+  m_stamped  = false;
+
+  // empty buffers
+  m_track.clear();
+  m_current.tracks.clear();
+}
+
+// ------
+// OnData
+// ------
+/*
+ *
+ */
+void CatalogHandler::OnData(unsigned keyID, const string& key, const string& value)
+{
+  // send message
+  ChainHandler::OnData(keyID, key, value);
+
+  // buffer tag
+  m_track.add(keyID, key, value);
+
+  // trigger found
+  if (keyID == keyinfo::COMPILATIONINDEX)
+  {
+    // record track
+    addTrack();
+
+    // empty buffers
+    m_track.clear();
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// ----
+// load
+// ----
+/*
+ *
+ */
+bool CatalogHandler::load(const string& catalog)
+{
+  // forget previous catalog
+  m_catalog  = catalog;
+  m_entries.clear();
+  m_modified = false;
+
+  // open catalog
+  ifstream file(catalog.c_str(), ios::in | ios::binary);
+
+  // catalog is missing (yet)
+  if ( !file )
+  {
+    // the catalog will be created
+    m_modified = true;
+
+    // signalize success
+    return true;
+  }
+
+  // read catalog at once
+  stringstream buffer;
+  buffer << file.rdbuf();
+
+  // read error
+  if ( file.bad() )
+  {
+    // notify user
+    msg::err( msg::catq("unable to read file: ", catalog) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // abbreviation
+  const string& data = buffer.str();
+
+  // check format (the catalog is rebuilt)
+  string::size_type pos = data.find('\n');
+  if ( (pos == string::npos) || (data.compare(0, pos, catalogHeader) != 0) )
+  {
+    // write catalog of this format
+    m_modified = true;
+
+    // signalize success
+    return true;
+  }
+
+  // the file of the following tracks (0: skip tracks)
+  Entry* entry = 0;
+  string filename;
+
+  // read one line per cycle
+  for(pos++; pos < data.size(); )
+  {
+    // get end of line
+    string::size_type last = data.find('\n', pos);
+
+    // incomplete line
+    if (last == string::npos)
+    {
+      // forget its file
+      if (entry != 0) m_entries.erase(filename);
+
+      // exit loop
+      break;
+    }
+
+    // line of a file
+    if (data[pos] == '@')
+    {
+      // size, modification time, digest and filename
+      istringstream line( data.substr(pos + 1, last - pos - 1) );
+      Entry         current;
+      char          dot  = 0;
+
+      line >> current.size >> current.sec >> dot >> current.nsec >> current.digest;
+      line.get();
+      filename.clear();
+      getline(line, filename);
+
+      // skip broken line
+      if ( !line || (dot != '.') || filename.empty() )
+      {
+        entry = 0;
+      }
+
+      else
+      {
+        current.seen = false;
+        entry = &( m_entries[filename] = current );
+      }
+    }
+
+    // line of a track
+    else if (entry != 0)
+    {
+      entry->tracks.append(data, pos, last - pos + 1);
+    }
+
+    // next line
+    pos = last + 1;
+  }
+
+  // signalize success
+  return true;
+}
+
+// ------
+// replay
+// ------
+/*
+ *
+ */
+bool CatalogHandler::replay(const string& filename)
+{
+  // find file
+  map<string, Entry>::iterator it = m_entries.find(filename);
+  if ( it == m_entries.end() ) return false;
+
+  // abbreviation
+  Entry& entry = it->second;
+
+  // get state of the file
+  struct stat info;
+  if (stat(filename.c_str(), &info) != 0) return false;
+
+  // size or modification time changed
+  if ( (entry.size != info.st_size)
+  ||   (entry.sec  != info.st_mtim.tv_sec)
+  ||   (entry.nsec != info.st_mtim.tv_nsec) )
+  {
+    // compare content
+    string digest;
+    if ( !fileDigest(filename, digest) || (digest != entry.digest) ) return false;
+
+    // update stamp
+    entry.size = info.st_size;
+    entry.sec  = info.st_mtim.tv_sec;
+    entry.nsec = info.st_mtim.tv_nsec;
+    m_modified = true;
+  }
+
+  // file has been listed
+  entry.seen = true;
+
+  // send message
+  ChainHandler::OnBeginParsing(filename);
+
+  // abbreviation
+  const string& tracks = entry.tracks;
+
+  // the current tag
+  string key;
+  string value;
+
+  // the part of the tag that is read (key or value)
+  string* part = &key;
+
+  // send tags
+  for(string::size_type i = 0; i < tracks.size(); i++)
+  {
+    // get current character
+    char c = tracks[i];
+
+    // escaped character
+    if ( (c == '\\') && (i + 1 < tracks.size()) )
+    {
+      c = tracks[++i];
+
+      if      (c == 't') *part += '\t';
+      else if (c == 'n') *part += '\n';
+      else               *part += c;
+    }
+
+    // end of key
+    else if ( (c == '=') && (part == &key) )
+    {
+      part = &value;
+    }
+
+    // end of tag
+    else if ( (c == '\t') || (c == '\n') )
+    {
+      // send tag
+      unsigned keyID = m_keys.intern(key);
+      ChainHandler::OnData(keyID, m_keys.name(keyID), value);
+
+      // next tag
+      key.clear();
+      value.clear();
+      part = &key;
+    }
+
+    // plain character
+    else
+    {
+      *part += c;
+    }
+  }
+
+  // send message
+  ChainHandler::OnEndParsing(true);
+
+  // signalize success
+  return true;
+}
+
+// ------
+// remove
+// ------
+/*
+ *
+ */
+void CatalogHandler::remove(const string& filename)
+{
+  // forget file
+  if (m_entries.erase(filename) > 0) m_modified = true;
+}
+
+// ----
+// save
+// ----
+/*
+ *
+ */
+bool CatalogHandler::save()
+{
+  // drop files that no longer exist
+  for(map<string, Entry>::iterator it = m_entries.begin(); it != m_entries.end(); )
+  {
+    // the state of the file
+    struct stat info;
+
+    // file has been deleted
+    if ( !it->second.seen && (stat(it->first.c_str(), &info) != 0) )
+    {
+      it = m_entries.erase(it);
+      m_modified = true;
+    }
+
+    else
+    {
+      ++it;
+    }
+  }
+
+  // nothing to do
+  if ( !m_modified ) return true;
+
+  // write to a temporary file first (unique per process)
+  string partfile = m_catalog + "." + msg::str(static_cast<unsigned>(getpid())) + ".part";
+
+  // open file for writing
+  OutputSink sink;
+
+  // check if file has been opened
+  if ( !sink.open(partfile) )
+  {
+    // notify user
+    msg::err( msg::catq("unable to open file: ", partfile) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // buffered stream
+  ostream out(&sink);
+
+  out << catalogHeader << '\n';
+
+  // write files
+  for(map<string, Entry>::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+  {
+    // abbreviation
+    const Entry& entry = it->second;
+
+    out << '@' << entry.size << ' ' << entry.sec << '.' << entry.nsec << ' '
+        << entry.digest << ' ' << it->first << '\n';
+    out << entry.tracks;
+  }
+
+  // check state of stream (and write remaining data), replace catalog
+  if ( !out || !sink.close() || (rename(partfile.c_str(), m_catalog.c_str()) != 0) )
+  {
+    // remove temporary file
+    unlink( partfile.c_str() );
+
+    // notify user
+    msg::err( msg::catq("unable to write file: ", m_catalog) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // catalog is up to date
+  m_modified = false;
+
+  // signalize success
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Internal methods                                             Internal methods
+// -----------------------------------------------------------------------------
+
+// --------
+// addTrack
+// --------
+/*
+ * KEY=value<TAB>KEY=value...<LF>
+ */
+void CatalogHandler::addTrack()
+{
+  // file can't be recorded
+  if ( !m_stamped ) return;
+
+  for(unsigned n = 0; n < m_track.size(); n++)
+  {
+    // separate tags
+    if (n > 0) m_current.tracks += '\t';
+
+    // add tag
+    escape(m_track.key(n), m_current.tracks);
+    m_current.tracks += '=';
+    escape(m_track.value(n), m_current.tracks);
+  }
+
+  m_current.tracks += '\n';
+}
@@ -0,0 +1,228 @@
+// -----------------------------------------------------------------------------
+// CatalogHandler.h                                             CatalogHandler.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref CatalogHandler class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef CATALOGHANDLER_H_INCLUDE_NO1
+#define CATALOGHANDLER_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <map>
+#include <string>
+#include "KeyTable.h"
+#include "TrackRecord.h"
+#include "ChainHandler.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// --------------
+// CatalogHandler
+// --------------
+/**
+ * @brief  This class records the tracks of each parsed file in an on-disk
+ *         catalog and sends the recorded tracks of unchanged files to the
+ *         next handler instead of parsing them again.
+ *
+ * The handler is placed in front of the consumer. A track is recorded as
+ * the tags the consumer has seen when COMPILATIONINDEX arrived. Each
+ * file is stamped with its size, modification time and MD5 digest; a
+ * file whose size or time changed is still unchanged if its digest
+ * matches. The catalog is a text file:
+ *
+ *     # ripgen catalog 1
+ *     @<size> <mtime> <digest> <filename>
+ *     KEY=value<TAB>KEY=value...
+ *
+ * with one line per track following the line of its file (backslashes,
+ * tabs and line breaks of the values are escaped).
+ */
+class CatalogHandler : public ChainHandler
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // --------------
+  // CatalogHandler
+  // --------------
+  /**
+   * @brief  The standard-constructor.
+   */
+  CatalogHandler(KVHandler* next = 0);
+
+
+  // ---------------------------------------------------------------------------
+  // Callback handler                                           Callback handler
+  // ---------------------------------------------------------------------------
+
+  // --------------
+  // OnBeginParsing
+  // --------------
+  /**
+   *
+   */
+  virtual void OnBeginParsing(const string& filename);
+
+  // ------------
+  // OnEndParsing
+  // ------------
+  /**
+   *
+   */
+  virtual void OnEndParsing(bool healthy);
+
+  // ------
+  // OnData
+  // ------
+  /**
+   *
+   */
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // ----
+  // load
+  // ----
+  /**
+   * @brief  This method reads the given catalog (a missing catalog is
+   *         empty, a catalog of another format is ignored).
+   *
+   * @return  false if the catalog exists but can't be read
+   */
+  bool load(const string& catalog);
+
+  // ------
+  // replay
+  // ------
+  /**
+   * @brief  This method sends the recorded tracks of the given file to
+   *         the next handler (like parsing the file would do).
+   *
+   * @return  false if the file is unknown (resp. has changed); nothing
+   *          has been sent in this case
+   */
+  bool replay(const string& filename);
+
+  // ------
+  // remove
+  // ------
+  /**
+   * @brief  This method removes the given file from the catalog (e.g. a
+   *         broken file that has been recorded by the last parse).
+   */
+  void remove(const string& filename);
+
+  // ----
+  // save
+  // ----
+  /**
+   * @brief  This method drops the files that no longer exist and writes
+   *         the catalog (if anything has changed).
+   *
+   * @return  false if the catalog can't be written
+   */
+  bool save();
+
+
+protected:
+
+  // ---------------------------------------------------------------------------
+  // Internal methods                                           Internal methods
+  // ---------------------------------------------------------------------------
+
+  // --------
+  // addTrack
+  // --------
+  /**
+   * @brief  This method records the buffered track.
+   */
+  void addTrack();
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Types                                                                 Types
+  // ---------------------------------------------------------------------------
+
+  // -----
+  // Entry
+  // -----
+  /**
+   * @brief  The recorded state of one file.
+   */
+  struct Entry
+  {
+    /// the size of the file
+    long long size;
+
+    /// the time of the last modification (seconds and nanoseconds)
+    long long sec;
+    long long nsec;
+
+    /// the MD5 digest of the file (hex)
+    string digest;
+
+    /// one line per track
+    string tracks;
+
+    /// the file has been listed by this run
+    bool seen;
+  };
+
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the name of the catalog
+  string m_catalog;
+
+  /// the recorded files
+  map<string, Entry> m_entries;
+
+  /// the catalog has to be written
+  bool m_modified;
+
+  /// the file that is currently parsed
+  string m_filename;
+
+  /// the state of the current file (false: can't be recorded)
+  bool m_stamped;
+
+  /// the recorded state of the current file
+  Entry m_current;
+
+  /// the tags of the current track
+  TrackRecord m_track;
+
+  /// the keys of the recorded tracks
+  KeyTable m_keys;
+
+};
+
+#endif  /* #ifndef CATALOGHANDLER_H_INCLUDE_NO1 */
@@ -45,6 +45,30 @@ ChainHandler::ChainHandler(KVHandler* next)
 void ChainHandler::setNextHandler(KVHandler* next)
 {
   m_next = next;
+
+  // pass flag to new handler
+  if (m_next)
+  {
+    m_next->setAbortSignal( abortSignal() );
+  }
+}
+
+// --------------
+// setAbortSignal
+// --------------
+/*
+ *
+ */
+void ChainHandler::setAbortSignal(bool* signal)
+{
+  // set own flag
+  KVHandler::setAbortSignal(signal);
+
+  // set flag of next handler
+  if (m_next)
+  {
+    m_next->setAbortSignal(signal);
+  }
 }
 
 
@@ -86,11 +110,11 @@ void ChainHandler::OnEndParsing(bool healthy)
 /*
  *
  */
-void ChainHandler::OnData(const string& key, const string& value)
+void ChainHandler::OnData(unsigned keyID, const string& key, const string& value)
 {
   if (m_next)
   {
-    m_next->OnData(key, value);
+    m_next->OnData(keyID, key, value);
   }
 }
 
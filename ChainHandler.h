@@ -58,6 +58,14 @@ public:
    */
   void setNextHandler(KVHandler* next);
 
+  // --------------
+  // setAbortSignal
+  // --------------
+  /**
+   * @brief  This method sets the flag of this and all following handlers.
+   */
+  virtual void setAbortSignal(bool* signal);
+
 
   // ---------------------------------------------------------------------------
   // Callback handler                                           Callback handler
@@ -85,7 +93,7 @@ public:
   /**
    *
    */
-  virtual void OnData(const string& key, const string& value);
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
 
 
   // ---------------------------------------------------------------------------
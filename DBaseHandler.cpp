@@ -33,7 +33,8 @@ using namespace std;
 /*
  *
  */
-DBaseHandler::DBaseHandler()
+DBaseHandler::DBaseHandler(ostream& out)
+: m_out(out)
 {
   // initialization
 }
@@ -58,8 +59,7 @@ void DBaseHandler::OnBeginParsing(const string& filename)
   m_filename = filename;
 
   // empty buffers
-  m_keys.clear();
-  m_values.clear();
+  m_track.clear();
 }
 
 // ------------
@@ -74,8 +74,7 @@ void DBaseHandler::OnEndParsing(bool healthy)
   m_filename = "";
 
   // empty buffers
-  m_keys.clear();
-  m_values.clear();
+  m_track.clear();
 }
 
 // ------
@@ -84,24 +83,22 @@ void DBaseHandler::OnEndParsing(bool healthy)
 /*
  *
  */
-void DBaseHandler::OnData(const string& key, const string& value)
+void DBaseHandler::OnData(unsigned keyID, const string& key, const string& value)
 {
   // don't run in bad state
   if ( !healthy() ) return;
 
   // buffer tag
-  m_keys.push_back(key);
-  m_values.push_back(value);
+  m_track.add(keyID, key, value);
 
   // trigger found
-  if (key == "COMPILATIONINDEX")
+  if (keyID == keyinfo::COMPILATIONINDEX)
   {
     // create output
     printBuffer();
 
     // empty buffers
-    m_keys.clear();
-    m_values.clear();
+    m_track.clear();
   }
 }
 
@@ -110,27 +107,6 @@ void DBaseHandler::OnData(const string& key, const string& value)
 // Internal methods                                             Internal methods
 // -----------------------------------------------------------------------------
 
-// --------
-// getValue
-// --------
-/*
- *
- */
-string DBaseHandler::getValue(const string& key) const
-{
-  // find related value
-  for(unsigned i = 0; i < m_keys.size(); i++)
-  {
-    if (m_keys[i] == key)
-    {
-      return m_values[i];
-    }
-  }
-
-  // key not found
-  return "";
-}
-
 // -----------
 // printBuffer
 // -----------
@@ -139,39 +115,45 @@ string DBaseHandler::getValue(const string& key) const
  */
 void DBaseHandler::printBuffer() const
 {
-  vector<string> order;
-  order.push_back( keyinfo::name(keyinfo::COMPILATIONID)    );
-  order.push_back( keyinfo::name(keyinfo::COMPILATIONINDEX) );
-  order.push_back( keyinfo::name(keyinfo::IMAGE)            );
-  order.push_back( keyinfo::name(keyinfo::AUTHOR)           );
-  order.push_back( keyinfo::name(keyinfo::COMPOSER)         );
-  order.push_back( keyinfo::name(keyinfo::LYRICIST)         );
-  order.push_back( keyinfo::name(keyinfo::OPUS)             );
-  order.push_back( keyinfo::name(keyinfo::VERSION)          );
-  order.push_back( keyinfo::name(keyinfo::ARRANGER)         );
-  order.push_back( keyinfo::name(keyinfo::PERFORMER)        );
-  order.push_back( keyinfo::name(keyinfo::CONDUCTOR)        );
-  order.push_back( keyinfo::name(keyinfo::ENSEMBLE)         );
-  order.push_back( keyinfo::name(keyinfo::ALBUMARTIST)      );
-  order.push_back( keyinfo::name(keyinfo::ALBUM)            );
-  order.push_back( keyinfo::name(keyinfo::GENRE)            );
-  order.push_back( keyinfo::name(keyinfo::DATE)             );
-  order.push_back( keyinfo::name(keyinfo::TRACKTOTAL)       );
-  order.push_back( keyinfo::name(keyinfo::TRACKNUMBER)      );
-  order.push_back( keyinfo::name(keyinfo::ARTIST)           );
-  order.push_back( keyinfo::name(keyinfo::TITLE)            );
-  order.push_back( keyinfo::name(keyinfo::COMMENT)          );
-  order.push_back( keyinfo::name(keyinfo::FILENAME)         );
+  // print columns in this order
+  static const keyinfo::KEYID order[] =
+  {
+    keyinfo::COMPILATIONID,
+    keyinfo::COMPILATIONINDEX,
+    keyinfo::IMAGE,
+    keyinfo::AUTHOR,
+    keyinfo::COMPOSER,
+    keyinfo::LYRICIST,
+    keyinfo::OPUS,
+    keyinfo::VERSION,
+    keyinfo::ARRANGER,
+    keyinfo::PERFORMER,
+    keyinfo::CONDUCTOR,
+    keyinfo::ENSEMBLE,
+    keyinfo::ALBUMARTIST,
+    keyinfo::ALBUM,
+    keyinfo::GENRE,
+    keyinfo::DATE,
+    keyinfo::TRACKTOTAL,
+    keyinfo::TRACKNUMBER,
+    keyinfo::ARTIST,
+    keyinfo::TITLE,
+    keyinfo::COMMENT,
+    keyinfo::FILENAME
+  };
+
+  // number of keys in this order
+  static const unsigned count = sizeof(order) / sizeof(order[0]);
 
   // start with the name of the source file
-  cout << "|CDFILE=" << m_filename;
+  m_out << "|CDFILE=" << m_filename;
 
   // print title related information
-  for(unsigned i = 0; i < order.size(); i++)
+  for(unsigned i = 0; i < count; i++)
   {
-    cout  << "|" << order[i] << "=" << getValue(order[i]);
+    m_out << "|" << keyinfo::name(order[i]) << "=" << m_track.get(order[i]);
   }
 
-  cout << "|" << endl;
+  m_out << "|\n";
 }
 
@@ -21,7 +21,9 @@
 // -----------------------------------------------------------------------------
 #include <vector>
 #include <string>
+#include <iostream>
 #include "KVHandler.h"
+#include "TrackRecord.h"
 
 
 // -----------------------------------------------------------------------------
@@ -50,8 +52,10 @@ public:
   // ------------
   /**
    * @brief  The standard-constructor.
+   *
+   * @param out  holds the stream that receives the database lines.
    */
-  DBaseHandler();
+  DBaseHandler(ostream& out = cout);
 
 
   // ---------------------------------------------------------------------------
@@ -80,7 +84,7 @@ public:
   /**
    *
    */
-  virtual void OnData(const string& key, const string& value);
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
 
 
 protected:
@@ -89,14 +93,6 @@ protected:
   // Internal methods                                           Internal methods
   // ---------------------------------------------------------------------------
 
-  // --------
-  // getValue
-  // --------
-  /**
-   *
-   */
-  string getValue(const string& key) const;
-
   // -----------
   // printBuffer
   // -----------
@@ -112,14 +108,14 @@ private:
   // Attributes                                                       Attributes
   // ---------------------------------------------------------------------------
 
+  /// the stream that receives the database lines
+  ostream& m_out;
+
   /// the file that is currently parsed
   string m_filename;
 
-  /// buffer of keys
-  vector<string> m_keys;
-
-  /// buffer of values
-  vector<string> m_values;
+  /// the tags of the current track
+  TrackRecord m_track;
 
 };
 
@@ -0,0 +1,109 @@
+// -----------------------------------------------------------------------------
+// EncodeCache.cpp                                               EncodeCache.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref EncodeCache class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include "MD5.h"
+#include "EncodeCache.h"
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// -----------
+// EncodeCache
+// -----------
+/*
+ *
+ */
+EncodeCache::EncodeCache(const string& directory)
+: m_directory(directory)
+{
+  // nothing
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// ------
+// locate
+// ------
+/*
+ * <MD5 of settings and wav file>-<size of wav file>.flac
+ */
+bool EncodeCache::locate(const string& wavfile, const string& settings, string& cachefile) const
+{
+  // open wav file
+  ifstream file(wavfile.c_str(), ios::in | ios::binary);
+  if ( !file ) return false;
+
+  // hash settings (with terminating NUL)
+  MD5 md5;
+  md5.update( settings.c_str(), settings.size() + 1 );
+
+  // the size of the wav file
+  unsigned long long size = 0;
+
+  // hash wav file
+  char buffer[65536];
+  while ( file.read(buffer, sizeof(buffer)) || (file.gcount() > 0) )
+  {
+    md5.update(buffer, file.gcount());
+    size += file.gcount();
+  }
+
+  // read error
+  if ( file.bad() ) return false;
+
+  // get digest
+  string digest = md5.digest();
+
+  // create name
+  stringstream strstr;
+  strstr << m_directory << (m_directory.empty() ? "" : "/") << hex << setfill('0');
+
+  for(string::size_type k = 0; k < digest.size(); k++)
+  {
+    strstr << setw(2) << static_cast<unsigned>( static_cast<unsigned char>(digest[k]) );
+  }
+
+  strstr << dec << "-" << size << ".flac";
+
+  // return name
+  cachefile = strstr.str();
+
+  // signalize success
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Status information                                         Status information
+// -----------------------------------------------------------------------------
+
+// ---------
+// directory
+// ---------
+/*
+ *
+ */
+const string& EncodeCache::directory() const
+{
+  return m_directory;
+}
+
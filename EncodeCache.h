@@ -0,0 +1,106 @@
+// -----------------------------------------------------------------------------
+// EncodeCache.h                                                   EncodeCache.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref EncodeCache class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef ENCODECACHE_H_INCLUDE_NO1
+#define ENCODECACHE_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <string>
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------
+// EncodeCache
+// -----------
+/**
+ * @brief  A directory of untagged flac files named by the content of
+ *         their wav file and the settings of the encoder.
+ *
+ * If only the tags (resp. the image or the name) of a track change,
+ * the cached audio is copied and tagged instead of being encoded again.
+ */
+class EncodeCache
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // -----------
+  // EncodeCache
+  // -----------
+  /**
+   * @brief  The standard-constructor.
+   *
+   * @param directory  holds the name of the cache directory.
+   */
+  EncodeCache(const string& directory = "");
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // ------
+  // locate
+  // ------
+  /**
+   * @brief  This method returns the name of the cached flac file of the
+   *         given wav file (whether it exists or not).
+   *
+   * @param wavfile    holds the name of the wav file.
+   * @param settings   holds the options of the encoder.
+   * @param cachefile  returns the name of the cached flac file.
+   *
+   * @return  false if the wav file can't be read
+   */
+  bool locate(const string& wavfile, const string& settings, string& cachefile) const;
+
+
+  // ---------------------------------------------------------------------------
+  // Status information                                       Status information
+  // ---------------------------------------------------------------------------
+
+  // ---------
+  // directory
+  // ---------
+  /**
+   * @brief  This method returns the name of the cache directory.
+   */
+  const string& directory() const;
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the name of the cache directory
+  string m_directory;
+
+};
+
+#endif  /* #ifndef ENCODECACHE_H_INCLUDE_NO1 */
+
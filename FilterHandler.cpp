@@ -62,7 +62,7 @@ void FilterHandler::OnBeginParsing(const string& filename)
 /*
  *
  */
-void FilterHandler::OnData(const string& key, const string& value)
+void FilterHandler::OnData(unsigned keyID, const string& key, const string& value)
 {
   // no handler set
   if (m_next == 0) return;
@@ -71,10 +71,10 @@ void FilterHandler::OnData(const string& key, const string& value)
   if ( !healthy() ) return;
 
   // let writable and internal keys pass
-  if ( keyinfo::isWritable(key) || (key[0] == '_') )
+  if ( (keyID < keyinfo::keyCount) ? keyinfo::isWritable(keyID) : (key[0] == '_') )
   {
     // notify next handler
-    m_next->OnData(key, value);
+    m_next->OnData(keyID, key, value);
   }
 
   else
@@ -64,7 +64,7 @@ public:
   /**
    *
    */
-  virtual void OnData(const string& key, const string& value);
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
 
 };
 
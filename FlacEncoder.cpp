@@ -0,0 +1,1343 @@
+// -----------------------------------------------------------------------------
+// FlacEncoder.cpp                                               FlacEncoder.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref FlacEncoder class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <cmath>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <fstream>
+#include <unistd.h>
+#include "message.h"
+#include "MD5.h"
+#include "BitReader.h"
+#include "FlacEncoder.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------------------------------------------------------------------------
+// Helper functions                                             Helper functions
+// -----------------------------------------------------------------------------
+
+/// the types of subframes
+enum
+{
+  CONSTANT,
+  VERBATIM,
+  FIXED,
+  LPC
+};
+
+/// the channel assignments of stereo frames
+enum
+{
+  INDEPENDENT = 1,
+  LEFT_SIDE   = 8,
+  SIDE_RIGHT  = 9,
+  MID_SIDE    = 10
+};
+
+/// the number of samples per channel and frame
+static const unsigned blockSize = 4096;
+
+/// the number of frames read at once (per thread)
+static const unsigned framesPerThread = 16;
+
+/// the highest order of LPC subframes
+static const unsigned maxLPCOrder = 12;
+
+/// the highest partition order of residuals (like flac -8)
+static const unsigned maxPartitionOrder = 6;
+
+// ---------
+// crc8Table
+// ---------
+/*
+ * CRC-8 (polynomial 0x07) of the frame header
+ */
+static const unsigned char* crc8Table()
+{
+  static unsigned char table[256];
+  static bool ready = false;
+
+  if ( !ready )
+  {
+    for(unsigned i = 0; i < 256; i++)
+    {
+      unsigned crc = i;
+      for(unsigned k = 0; k < 8; k++)
+      {
+        crc = (crc & 0x80) ? ((crc << 1) ^ 0x07) : (crc << 1);
+      }
+      table[i] = static_cast<unsigned char>(crc);
+    }
+    ready = true;
+  }
+
+  return table;
+}
+
+// ----------
+// crc16Table
+// ----------
+/*
+ * CRC-16 (polynomial 0x8005) of the whole frame
+ */
+static const uint16_t* crc16Table()
+{
+  static uint16_t table[256];
+  static bool ready = false;
+
+  if ( !ready )
+  {
+    for(unsigned i = 0; i < 256; i++)
+    {
+      unsigned crc = i << 8;
+      for(unsigned k = 0; k < 8; k++)
+      {
+        crc = (crc & 0x8000) ? ((crc << 1) ^ 0x8005) : (crc << 1);
+      }
+      table[i] = static_cast<uint16_t>(crc);
+    }
+    ready = true;
+  }
+
+  return table;
+}
+
+// ----
+// crc8
+// ----
+/*
+ *
+ */
+static unsigned crc8(const string& data, size_t size)
+{
+  const unsigned char* table = crc8Table();
+  unsigned crc = 0;
+
+  for(size_t i = 0; i < size; i++)
+  {
+    crc = table[crc ^ static_cast<unsigned char>(data[i])];
+  }
+
+  return crc;
+}
+
+// -----
+// crc16
+// -----
+/*
+ *
+ */
+static unsigned crc16(const string& data, size_t size)
+{
+  const uint16_t* table = crc16Table();
+  unsigned crc = 0;
+
+  for(size_t i = 0; i < size; i++)
+  {
+    crc = ((crc << 8) & 0xFFFF) ^ table[(crc >> 8) ^ static_cast<unsigned char>(data[i])];
+  }
+
+  return crc;
+}
+
+// -------------
+// fixedResidual
+// -------------
+/*
+ * the residual of the fixed predictor of the given order
+ */
+static void fixedResidual(const vector<int32_t>& x, unsigned order, vector<int64_t>& residual)
+{
+  residual.resize(x.size());
+
+  for(size_t i = order; i < x.size(); i++)
+  {
+    int64_t a = x[i];
+
+    switch (order)
+    {
+      case 0: residual[i] = a; break;
+      case 1: residual[i] = a - x[i-1]; break;
+      case 2: residual[i] = a - 2 * int64_t(x[i-1]) + x[i-2]; break;
+      case 3: residual[i] = a - 3 * int64_t(x[i-1]) + 3 * int64_t(x[i-2]) - x[i-3]; break;
+      case 4: residual[i] = a - 4 * int64_t(x[i-1]) + 6 * int64_t(x[i-2]) - 4 * int64_t(x[i-3]) + x[i-4]; break;
+    }
+  }
+}
+
+// ----------
+// fixedValue
+// ----------
+/*
+ * the sample restored from the residual of the fixed predictor
+ */
+static int64_t fixedValue(const vector<int64_t>& x, size_t i, unsigned order, int64_t residual)
+{
+  switch (order)
+  {
+    case 1: return residual + x[i-1];
+    case 2: return residual + 2 * x[i-1] - x[i-2];
+    case 3: return residual + 3 * x[i-1] - 3 * x[i-2] + x[i-3];
+    case 4: return residual + 4 * x[i-1] - 6 * x[i-2] + 4 * x[i-3] - x[i-4];
+  }
+
+  return residual;
+}
+
+// -----------
+// lpcResidual
+// -----------
+/*
+ * the residual of the quantized linear predictor
+ */
+static void lpcResidual(const vector<int32_t>& x, const vector<int32_t>& qlp, unsigned shift, vector<int64_t>& residual)
+{
+  residual.resize(x.size());
+
+  for(size_t i = qlp.size(); i < x.size(); i++)
+  {
+    int64_t sum = 0;
+    for(size_t j = 0; j < qlp.size(); j++)
+    {
+      sum += int64_t(qlp[j]) * x[i - j - 1];
+    }
+    residual[i] = x[i] - (sum >> shift);
+  }
+}
+
+
+// -----------
+// tukeyWindow
+// -----------
+/*
+ * Tukey window (tapering a quarter of the samples at each end)
+ */
+static void tukeyWindow(size_t count, vector<double>& window)
+{
+  window.assign(count, 1.0);
+
+  size_t taper = count / 4;
+  for(size_t i = 0; i < taper; i++)
+  {
+    double factor = 0.5 - 0.5 * cos(M_PI * i / taper);
+    window[i]             = factor;
+    window[count - 1 - i] = factor;
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// -----------
+// FlacEncoder
+// -----------
+/*
+ *
+ */
+FlacEncoder::FlacEncoder(unsigned threads)
+: m_threads(threads)
+{
+  // one frame per processor
+  if (m_threads == 0)
+  {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    m_threads = (count > 0) ? static_cast<unsigned>(count) : 1;
+  }
+
+  // create tables before the first thread does
+  crc8Table();
+  crc16Table();
+  tukeyWindow(blockSize, m_window);
+
+  // no wav file read yet
+  m_format.channels = 0;
+  m_format.bits     = 0;
+  m_format.rate     = 0;
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// ------
+// encode
+// ------
+/*
+ *
+ */
+bool FlacEncoder::encode(const string& wavfile, const string& flacfile, unsigned padding)
+{
+  // open wav file
+  ifstream in(wavfile.c_str(), ios::in | ios::binary);
+
+  // the size of the samples (in bytes)
+  uint64_t size = 0;
+
+  if ( !in || !readHeader(in, size) )
+  {
+    // notify user
+    msg::err( msg::catq("unsupported wav file: ", wavfile) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // create flac file
+  ofstream out(flacfile.c_str(), ios::out | ios::binary | ios::trunc);
+
+  // stream marker, stream info (completed at the end) and padding
+  string header = "fLaC" + streamInfo(0, 0, 0, string(16, '\0'));
+  header += static_cast<char>(0x81);
+  header += static_cast<char>( (padding >> 16) & 0xFF );
+  header += static_cast<char>( (padding >>  8) & 0xFF );
+  header += static_cast<char>(  padding        & 0xFF );
+  header.append(padding, '\0');
+  out.write(header.data(), header.size());
+
+  // the size of one sample (in bytes)
+  unsigned width     = (m_format.bits + 7) / 8;
+  unsigned frameSize = width * m_format.channels;
+
+  // the digest of the samples
+  MD5 md5;
+
+  // the number of samples (per channel) and frames
+  uint64_t total  = 0;
+  uint64_t number = 0;
+
+  // the sizes of the smallest and the largest frame
+  unsigned minFrame = 0;
+  unsigned maxFrame = 0;
+
+  // all frames decode to their samples
+  bool verified = true;
+
+  // the raw and converted samples of several frames
+  string          raw;
+  vector<int32_t> samples;
+
+  // the encoded frames
+  vector<string> frames;
+
+  while ( verified && out && (size > 0) )
+  {
+    // read several frames at once
+    uint64_t chunk = uint64_t(blockSize) * frameSize * framesPerThread * m_threads;
+    if (chunk > size) chunk = size;
+
+    raw.resize(chunk);
+    in.read(&raw[0], chunk);
+
+    // get complete samples
+    size_t count = in.gcount() / frameSize;
+    raw.resize(count * frameSize);
+    size = (in.gcount() < static_cast<streamsize>(chunk)) ? 0 : (size - chunk);
+
+    // end of data
+    if (count == 0) break;
+
+    // convert samples (8 bit samples are unsigned)
+    samples.resize(count * m_format.channels);
+    for(size_t i = 0; i < samples.size(); i++)
+    {
+      const unsigned char* p = reinterpret_cast<const unsigned char*>(&raw[i * width]);
+
+      if (width == 1)
+      {
+        samples[i] = int32_t(p[0]) - 128;
+        raw[i]     = static_cast<char>(p[0] ^ 0x80);
+      }
+
+      else if (width == 2)
+      {
+        samples[i] = int16_t(p[0] | (p[1] << 8));
+      }
+
+      else
+      {
+        samples[i] = (int32_t(uint32_t(p[0] | (p[1] << 8) | (p[2] << 16)) << 8)) >> 8;
+      }
+    }
+
+    // the digest covers the signed samples
+    md5.update(raw.data(), raw.size());
+
+    // encode frames
+    size_t frameCount = (count + blockSize - 1) / blockSize;
+    frames.assign(frameCount, string());
+
+    // the next frame to encode
+    atomic<size_t> next(0);
+    atomic<bool>   failed(false);
+
+    // encoding of one thread
+    auto work = [&]()
+    {
+      for(size_t f = next++; f < frameCount; f = next++)
+      {
+        // the samples of this frame
+        size_t   first = f * blockSize;
+        unsigned n     = static_cast<unsigned>( (count - first < blockSize) ? (count - first) : blockSize );
+
+        if ( !encodeFrame(&samples[first * m_format.channels], n, number + f, frames[f]) )
+        {
+          failed = true;
+        }
+      }
+    };
+
+    // start threads
+    vector<thread> threads;
+    for(unsigned t = 1; (t < m_threads) && (t < frameCount); t++)
+    {
+      threads.push_back( thread(work) );
+    }
+
+    // take part
+    work();
+
+    // wait for threads
+    for(unsigned t = 0; t < threads.size(); t++)
+    {
+      threads[t].join();
+    }
+
+    // check frames
+    if (failed)
+    {
+      verified = false;
+      break;
+    }
+
+    // write frames
+    for(size_t f = 0; f < frameCount; f++)
+    {
+      out.write(frames[f].data(), frames[f].size());
+
+      unsigned bytes = static_cast<unsigned>( frames[f].size() );
+      if ( (minFrame == 0) || (bytes < minFrame) ) minFrame = bytes;
+      if (bytes > maxFrame) maxFrame = bytes;
+    }
+
+    total  += count;
+    number += frameCount;
+  }
+
+  // complete stream info
+  header = streamInfo(minFrame, maxFrame, total, md5.digest());
+  out.seekp(4);
+  out.write(header.data(), header.size());
+  out.close();
+
+  // check state
+  if ( !verified || !out || in.bad() )
+  {
+    // remove broken file
+    remove( flacfile.c_str() );
+
+    // notify user
+    if ( !verified )
+    {
+      msg::err( msg::catq("verification failed: ", wavfile) );
+    }
+
+    else
+    {
+      msg::err( msg::catq("unable to write flac file: ", flacfile) );
+    }
+
+    // signalize trouble
+    return false;
+  }
+
+  // signalize success
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Internal methods                                             Internal methods
+// -----------------------------------------------------------------------------
+
+// ----------
+// readHeader
+// ----------
+/*
+ * RIFF/WAVE with a PCM "fmt " chunk (resp. WAVE_FORMAT_EXTENSIBLE)
+ */
+bool FlacEncoder::readHeader(istream& in, uint64_t& size)
+{
+  // little endian number of the given size at position n
+  auto number = [](const string& data, size_t n, unsigned bytes) -> uint32_t
+  {
+    uint32_t value = 0;
+    for(unsigned i = bytes; i > 0; i--)
+    {
+      value = (value << 8) | static_cast<unsigned char>(data[n + i - 1]);
+    }
+    return value;
+  };
+
+  // check RIFF header
+  string riff(12, '\0');
+  if ( !in.read(&riff[0], 12) || (riff.compare(0, 4, "RIFF") != 0) || (riff.compare(8, 4, "WAVE") != 0) ) return false;
+
+  // the format has been found
+  bool format = false;
+
+  // read chunks up to the samples
+  string chunk(8, '\0');
+  while ( in.read(&chunk[0], 8) )
+  {
+    // get size of chunk
+    uint32_t length = number(chunk, 4, 4);
+
+    // samples found
+    if (chunk.compare(0, 4, "data") == 0)
+    {
+      // get size (unknown size of streamed files)
+      size = ( (length == 0) || (length == 0xFFFFFFFF) ) ? UINT64_MAX : length;
+
+      // format must precede samples
+      return format;
+    }
+
+    // read chunk (padded to even size)
+    string data(length + (length & 1), '\0');
+    if ( !in.read(&data[0], data.size()) ) return false;
+
+    // format found
+    if ( (chunk.compare(0, 4, "fmt ") == 0) && (length >= 16) )
+    {
+      // get tag (WAVE_FORMAT_EXTENSIBLE holds the tag in its sub format)
+      unsigned tag = number(data, 0, 2);
+      if ( (tag == 0xFFFE) && (length >= 26) ) tag = number(data, 24, 2);
+
+      m_format.channels = number(data, 2, 2);
+      m_format.rate     = number(data, 4, 4);
+      m_format.bits     = number(data, 14, 2);
+
+      // check format
+      format = (tag == 1)
+            && (m_format.channels >= 1) && (m_format.channels <= 8)
+            && (m_format.rate >= 1) && (m_format.rate <= 655350)
+            && ( (m_format.bits == 8) || (m_format.bits == 16) || (m_format.bits == 24) );
+
+      if ( !format ) return false;
+    }
+  }
+
+  // no samples found
+  return false;
+}
+
+// -----------
+// encodeFrame
+// -----------
+/*
+ *
+ */
+bool FlacEncoder::encodeFrame(const int32_t* samples, unsigned count, uint64_t number, string& frame) const
+{
+  // abbreviations
+  unsigned channels = m_format.channels;
+  unsigned bits     = m_format.bits;
+
+  // get channels
+  vector< vector<int32_t> > x(channels, vector<int32_t>(count));
+  for(unsigned c = 0; c < channels; c++)
+  {
+    for(unsigned i = 0; i < count; i++)
+    {
+      x[c][i] = samples[i * channels + c];
+    }
+  }
+
+  // encode channels independently
+  vector<Subframe> subs(channels);
+  for(unsigned c = 0; c < channels; c++)
+  {
+    encodeSubframe(x[c], bits, subs[c]);
+  }
+
+  // channel assignment
+  unsigned assignment = channels - 1;
+
+  // the channels actually written
+  const vector<int32_t>* first  = channels > 0 ? &x[0] : 0;
+  const vector<int32_t>* second = channels > 1 ? &x[1] : 0;
+
+  // try stereo decorrelation
+  vector<int32_t> mid;
+  vector<int32_t> side;
+  Subframe        msub;
+  Subframe        ssub;
+
+  if (channels == 2)
+  {
+    // get mid and side channel
+    mid.resize(count);
+    side.resize(count);
+    for(unsigned i = 0; i < count; i++)
+    {
+      mid[i]  = (x[0][i] + x[1][i]) >> 1;
+      side[i] =  x[0][i] - x[1][i];
+    }
+
+    encodeSubframe(mid,  bits,     msub);
+    encodeSubframe(side, bits + 1, ssub);
+
+    // the sizes of all assignments
+    uint64_t independent = subs[0].size + subs[1].size;
+    uint64_t leftSide    = subs[0].size + ssub.size;
+    uint64_t sideRight   = ssub.size    + subs[1].size;
+    uint64_t midSide     = msub.size    + ssub.size;
+
+    // choose the smallest one
+    if ( (leftSide < independent) && (leftSide <= sideRight) && (leftSide <= midSide) )
+    {
+      assignment = LEFT_SIDE;
+      second     = &side;
+      subs[1]    = ssub;
+    }
+
+    else if ( (sideRight < independent) && (sideRight <= midSide) )
+    {
+      assignment = SIDE_RIGHT;
+      first      = &side;
+      subs[0]    = ssub;
+    }
+
+    else if (midSide < independent)
+    {
+      assignment = MID_SIDE;
+      first      = &mid;
+      second     = &side;
+      subs[0]    = msub;
+      subs[1]    = ssub;
+    }
+  }
+
+  // write frame header
+  BitWriter out;
+  out.write(0x3FFE, 14);
+  out.write(0, 1);
+  out.write(0, 1);
+
+  // block size
+  unsigned sizeCode = (count == blockSize) ? 12 : ( (count <= 256) ? 6 : 7 );
+  out.write(sizeCode, 4);
+
+  // sample rate
+  unsigned rate     = m_format.rate;
+  unsigned rateCode = 0;
+  switch (rate)
+  {
+    case  88200: rateCode =  1; break;
+    case 176400: rateCode =  2; break;
+    case 192000: rateCode =  3; break;
+    case   8000: rateCode =  4; break;
+    case  16000: rateCode =  5; break;
+    case  22050: rateCode =  6; break;
+    case  24000: rateCode =  7; break;
+    case  32000: rateCode =  8; break;
+    case  44100: rateCode =  9; break;
+    case  48000: rateCode = 10; break;
+    case  96000: rateCode = 11; break;
+    default:     rateCode = ( (rate % 1000 == 0) && (rate / 1000 <= 255) ) ? 12
+                          : ( (rate <= 65535) ? 13 : ( (rate % 10 == 0) ? 14 : 0 ) );
+  }
+  out.write(rateCode, 4);
+
+  // channels, sample size
+  out.write(assignment, 4);
+  out.write( (bits == 8) ? 1 : ( (bits == 16) ? 4 : 6 ), 3 );
+  out.write(0, 1);
+
+  // frame number (UTF-8 coded)
+  if (number < 0x80)
+  {
+    out.write(number, 8);
+  }
+
+  else
+  {
+    // the number of continuation bytes
+    unsigned more = 1;
+    while ( (more < 6) && (number >> (6 * more + 6 - more)) ) more++;
+
+    out.write( ((0xFF00 >> (more + 1)) & 0xFF) | (number >> (6 * more)), 8 );
+    for(unsigned k = more; k > 0; k--)
+    {
+      out.write( 0x80 | ((number >> (6 * (k - 1))) & 0x3F), 8 );
+    }
+  }
+
+  // block size and sample rate at the end of the header
+  if (sizeCode == 6)  out.write(count - 1, 8);
+  if (sizeCode == 7)  out.write(count - 1, 16);
+  if (rateCode == 12) out.write(rate / 1000, 8);
+  if (rateCode == 13) out.write(rate, 16);
+  if (rateCode == 14) out.write(rate / 10, 16);
+
+  // header checksum
+  out.write( crc8(out.data(), out.data().size()), 8 );
+
+  // write subframes
+  for(unsigned c = 0; c < channels; c++)
+  {
+    const vector<int32_t>& samples = (c == 0) ? *first : ( (c == 1) ? *second : x[c] );
+    writeSubframe(out, samples, subs[c]);
+  }
+
+  // frame checksum
+  out.align();
+  out.write( crc16(out.data(), out.data().size()), 16 );
+
+  // get frame
+  frame = out.data();
+
+  // verify frame
+  vector<int32_t> decoded;
+  if ( !decodeFrame(frame, count, decoded) ) return false;
+
+  for(size_t i = 0; i < decoded.size(); i++)
+  {
+    if (decoded[i] != samples[i]) return false;
+  }
+
+  // signalize success
+  return true;
+}
+
+// --------------
+// encodeSubframe
+// --------------
+/*
+ *
+ */
+void FlacEncoder::encodeSubframe(const vector<int32_t>& x, unsigned bits, Subframe& sub) const
+{
+  // abbreviation
+  size_t count = x.size();
+
+  // start with verbatim samples
+  sub.type  = VERBATIM;
+  sub.bits  = bits;
+  sub.order = 0;
+  sub.size  = 8 + uint64_t(bits) * count;
+
+  // check for constant samples
+  bool constant = true;
+  for(size_t i = 1; constant && (i < count); i++)
+  {
+    constant = (x[i] == x[0]);
+  }
+
+  if (constant)
+  {
+    sub.type = CONSTANT;
+    sub.size = 8 + bits;
+    return;
+  }
+
+  // try fixed predictors
+  vector<int64_t>  residual;
+  vector<unsigned> parameters;
+  unsigned         partitionOrder = 0;
+
+  for(unsigned order = 0; (order <= 4) && (order < count); order++)
+  {
+    // get residual
+    fixedResidual(x, order, residual);
+
+    // get size
+    uint64_t size = 8 + uint64_t(bits) * order + fitResidual(residual, order, partitionOrder, parameters);
+
+    // keep smaller encoding
+    if (size < sub.size)
+    {
+      sub.type           = FIXED;
+      sub.order          = order;
+      sub.size           = size;
+      sub.partitionOrder = partitionOrder;
+      sub.parameters     = parameters;
+      sub.residual.swap(residual);
+    }
+  }
+
+  // try linear prediction
+  tryLPC(x, sub);
+}
+
+// ------
+// tryLPC
+// ------
+/*
+ * Tukey(0.5) window, Levinson-Durbin recursion, estimated order
+ */
+void FlacEncoder::tryLPC(const vector<int32_t>& x, Subframe& sub) const
+{
+  // abbreviation
+  size_t count = x.size();
+
+  // the highest order
+  unsigned maxOrder = maxLPCOrder;
+  if (count <= maxOrder * 2) return;
+
+  // get window (computed once for full frames)
+  vector<double> window;
+  if (count != m_window.size()) tukeyWindow(count, window);
+  const vector<double>& factors = (count == m_window.size()) ? m_window : window;
+
+  // apply window
+  vector<double> w(count);
+  for(size_t i = 0; i < count; i++)
+  {
+    w[i] = x[i] * factors[i];
+  }
+
+  // get autocorrelation
+  double autoc[maxLPCOrder + 1];
+  for(unsigned lag = 0; lag <= maxOrder; lag++)
+  {
+    double sum = 0;
+    for(size_t i = lag; i < count; i++)
+    {
+      sum += w[i] * w[i - lag];
+    }
+    autoc[lag] = sum;
+  }
+
+  // silence
+  if (autoc[0] == 0) return;
+
+  // Levinson-Durbin recursion (coefficients and error of each order)
+  double lpc[maxLPCOrder];
+  double coefficients[maxLPCOrder][maxLPCOrder];
+  double error[maxLPCOrder];
+  double err = autoc[0];
+
+  for(unsigned i = 0; i < maxOrder; i++)
+  {
+    // get reflection coefficient
+    double r = -autoc[i + 1];
+    for(unsigned j = 0; j < i; j++)
+    {
+      r -= lpc[j] * autoc[i - j];
+    }
+    r /= err;
+
+    // update coefficients
+    lpc[i] = r;
+    for(unsigned j = 0; j < i / 2; j++)
+    {
+      double tmp = lpc[j];
+      lpc[j]         += r * lpc[i - 1 - j];
+      lpc[i - 1 - j] += r * tmp;
+    }
+    if (i & 1) lpc[i / 2] += lpc[i / 2] * r;
+
+    err *= (1.0 - r * r);
+
+    // store coefficients of this order
+    for(unsigned j = 0; j <= i; j++)
+    {
+      coefficients[i][j] = -lpc[j];
+    }
+    error[i] = err;
+
+    // perfect prediction
+    if (err <= 0)
+    {
+      maxOrder = i + 1;
+      break;
+    }
+  }
+
+  // precision of the coefficients (the prediction fits into 32 bits)
+  unsigned precision = 12;
+  if (sub.bits + precision + 4 > 32) precision = 32 - sub.bits - 4;
+  if (precision < 5) return;
+
+  // estimate best order
+  unsigned order = 0;
+  double   best  = 0;
+  for(unsigned i = 0; i < maxOrder; i++)
+  {
+    // bits per residual sample
+    double bps = (error[i] > 0) ? 0.5 * log2(0.5 * error[i] / count) : 0;
+    if (bps < 0) bps = 0;
+
+    // total bits
+    double bits = bps * (count - i - 1) + (i + 1) * (precision + sub.bits);
+
+    if ( (order == 0) || (bits < best) )
+    {
+      order = i + 1;
+      best  = bits;
+    }
+  }
+
+  // get largest coefficient
+  const double* c = coefficients[order - 1];
+  double cmax = 0;
+  for(unsigned j = 0; j < order; j++)
+  {
+    if (fabs(c[j]) > cmax) cmax = fabs(c[j]);
+  }
+  if (cmax <= 0) return;
+
+  // get shift
+  int log2cmax = 0;
+  frexp(cmax, &log2cmax);
+  int shift = static_cast<int>(precision) - 1 - (log2cmax - 1) - 1;
+  if (shift > 15) shift = 15;
+  if (shift < 0) return;
+
+  // quantize coefficients
+  int32_t qmax = (1 << (precision - 1)) - 1;
+  int32_t qmin = -(1 << (precision - 1));
+
+  vector<int32_t> qlp(order);
+  double qerror = 0;
+  for(unsigned j = 0; j < order; j++)
+  {
+    qerror += c[j] * (1 << shift);
+    long q = lround(qerror);
+    if (q > qmax) q = qmax;
+    if (q < qmin) q = qmin;
+    qerror -= q;
+    qlp[j] = static_cast<int32_t>(q);
+  }
+
+  // get residual
+  vector<int64_t> residual;
+  lpcResidual(x, qlp, shift, residual);
+
+  // get size
+  vector<unsigned> parameters;
+  unsigned         partitionOrder = 0;
+  uint64_t size = 8 + uint64_t(sub.bits) * order + 4 + 5 + precision * order
+                + fitResidual(residual, order, partitionOrder, parameters);
+
+  // keep smaller encoding
+  if (size < sub.size)
+  {
+    sub.type           = LPC;
+    sub.order          = order;
+    sub.precision      = precision;
+    sub.shift          = static_cast<unsigned>(shift);
+    sub.coefficients   = qlp;
+    sub.size           = size;
+    sub.partitionOrder = partitionOrder;
+    sub.parameters     = parameters;
+    sub.residual.swap(residual);
+  }
+}
+
+// -----------
+// fitResidual
+// -----------
+/*
+ * the size of a partition is estimated by the sum of its folded values;
+ * the sums of the finest partitions are added up for coarser ones
+ */
+uint64_t FlacEncoder::fitResidual(const vector<int64_t>& residual, unsigned order, unsigned& partitionOrder, vector<unsigned>& parameters) const
+{
+  // abbreviation
+  size_t count = residual.size();
+
+  // get finest partition order (equal partitions holding more than the warm-up samples)
+  unsigned finest = 0;
+  while ( (finest < maxPartitionOrder)
+  &&      ((count >> (finest + 1)) << (finest + 1) == count)
+  &&      ((count >> (finest + 1)) > order) )
+  {
+    finest++;
+  }
+
+  // get sums of folded values of the finest partitions
+  size_t partitionSize = count >> finest;
+  vector<uint64_t> sums(size_t(1) << finest, 0);
+  for(size_t k = 0; k < sums.size(); k++)
+  {
+    size_t first = (k == 0) ? order : k * partitionSize;
+    size_t last  = (k + 1) * partitionSize;
+
+    uint64_t sum = 0;
+    for(size_t i = first; i < last; i++)
+    {
+      sum += (residual[i] < 0) ? ((uint64_t(-(residual[i] + 1)) << 1) | 1) : (uint64_t(residual[i]) << 1);
+    }
+    sums[k] = sum;
+  }
+
+  // the best size so far
+  uint64_t best = UINT64_MAX;
+
+  // the parameters of one partition order
+  vector<unsigned> candidates;
+
+  for(unsigned p = finest + 1; p > 0; p--)
+  {
+    // the current partition order
+    unsigned current = p - 1;
+
+    // add up sums of the finer partitions
+    if (current < finest)
+    {
+      for(size_t k = 0; k < (size_t(1) << current); k++)
+      {
+        sums[k] = sums[2 * k] + sums[2 * k + 1];
+      }
+    }
+
+    // the size of this partition order (including the method and order fields)
+    uint64_t size = 2 + 4;
+    candidates.clear();
+
+    for(size_t k = 0; k < (size_t(1) << current); k++)
+    {
+      // get number of samples
+      size_t n = (count >> current) - ( (k == 0) ? order : 0 );
+
+      // the parameter is close to the number of bits of the mean value
+      unsigned mean = 0;
+      while ( (mean < 30) && ((uint64_t(n) << mean) < sums[k]) ) mean++;
+
+      // find best parameter
+      unsigned parameter = 0;
+      uint64_t bits      = UINT64_MAX;
+      for(unsigned r = (mean > 1) ? mean - 2 : 0; (r <= mean + 1) && (r <= 30); r++)
+      {
+        uint64_t b = uint64_t(n) * (r + 1) + (sums[k] >> r);
+        if (b < bits)
+        {
+          bits      = b;
+          parameter = r;
+        }
+      }
+
+      // parameter and samples
+      size += 5 + bits;
+      candidates.push_back(parameter);
+    }
+
+    // keep best partition order
+    if (size < best)
+    {
+      best           = size;
+      partitionOrder = current;
+      parameters     = candidates;
+    }
+  }
+
+  return best;
+}
+
+// -------------
+// writeSubframe
+// -------------
+/*
+ *
+ */
+void FlacEncoder::writeSubframe(BitWriter& out, const vector<int32_t>& x, const Subframe& sub) const
+{
+  // type
+  out.write(0, 1);
+  if (sub.type == CONSTANT) out.write(0, 6);
+  if (sub.type == VERBATIM) out.write(1, 6);
+  if (sub.type == FIXED)    out.write(8 | sub.order, 6);
+  if (sub.type == LPC)      out.write(32 | (sub.order - 1), 6);
+
+  // no wasted bits
+  out.write(0, 1);
+
+  // constant value
+  if (sub.type == CONSTANT)
+  {
+    out.write(static_cast<uint64_t>(int64_t(x[0])), sub.bits);
+    return;
+  }
+
+  // verbatim samples
+  if (sub.type == VERBATIM)
+  {
+    for(size_t i = 0; i < x.size(); i++)
+    {
+      out.write(static_cast<uint64_t>(int64_t(x[i])), sub.bits);
+    }
+    return;
+  }
+
+  // warm-up samples
+  for(unsigned i = 0; i < sub.order; i++)
+  {
+    out.write(static_cast<uint64_t>(int64_t(x[i])), sub.bits);
+  }
+
+  // coefficients
+  if (sub.type == LPC)
+  {
+    out.write(sub.precision - 1, 4);
+    out.write(sub.shift, 5);
+    for(unsigned j = 0; j < sub.order; j++)
+    {
+      out.write(static_cast<uint64_t>(int64_t(sub.coefficients[j])), sub.precision);
+    }
+  }
+
+  // coding method (RICE2 for large parameters)
+  bool rice2 = false;
+  for(unsigned k = 0; k < sub.parameters.size(); k++)
+  {
+    if (sub.parameters[k] >= 15) rice2 = true;
+  }
+  out.write(rice2 ? 1 : 0, 2);
+  out.write(sub.partitionOrder, 4);
+
+  // partitions
+  size_t partitionSize = x.size() >> sub.partitionOrder;
+  for(size_t k = 0; k < sub.parameters.size(); k++)
+  {
+    out.write(sub.parameters[k], rice2 ? 5 : 4);
+
+    size_t first = (k == 0) ? sub.order : k * partitionSize;
+    size_t last  = (k + 1) * partitionSize;
+    for(size_t i = first; i < last; i++)
+    {
+      out.writeRice(sub.residual[i], sub.parameters[k]);
+    }
+  }
+}
+
+// -----------
+// decodeFrame
+// -----------
+/*
+ *
+ */
+bool FlacEncoder::decodeFrame(const string& frame, unsigned count, vector<int32_t>& samples) const
+{
+  // abbreviations
+  unsigned channels = m_format.channels;
+  unsigned bits     = m_format.bits;
+
+  // check frame checksum
+  if ( (frame.size() < 2) || (crc16(frame, frame.size()) != 0) ) return false;
+
+  BitReader in(frame);
+
+  // sync code, reserved bit, blocking strategy
+  if (in.read(14) != 0x3FFE) return false;
+  if (in.read(2) != 0) return false;
+
+  // block size, sample rate, channel assignment, sample size
+  unsigned sizeCode   = in.read(4);
+  unsigned rateCode   = in.read(4);
+  unsigned assignment = in.read(4);
+  unsigned sampleCode = in.read(3);
+  in.read(1);
+
+  if (sampleCode != ( (bits == 8) ? 1u : ( (bits == 16) ? 4u : 6u ) )) return false;
+
+  // frame number
+  uint64_t lead = in.read(8);
+  for(unsigned mask = 0x40; (lead & 0x80) && (lead & mask); mask >>= 1)
+  {
+    in.read(8);
+  }
+
+  // block size
+  unsigned n = 0;
+  if (sizeCode == 12) n = blockSize;
+  if (sizeCode == 6)  n = in.read(8) + 1;
+  if (sizeCode == 7)  n = in.read(16) + 1;
+  if (n != count) return false;
+
+  // sample rate
+  if (rateCode == 12) in.read(8);
+  if (rateCode == 13 || rateCode == 14) in.read(16);
+
+  // header checksum
+  size_t headerSize = in.position() / 8;
+  if (in.read(8) != crc8(frame, headerSize)) return false;
+
+  // check channel assignment
+  bool stereo = (assignment >= LEFT_SIDE) && (assignment <= MID_SIDE);
+  if ( stereo ? (channels != 2) : (assignment != channels - 1) ) return false;
+
+  // decode subframes
+  vector< vector<int64_t> > x(channels, vector<int64_t>(n));
+  for(unsigned c = 0; c < channels; c++)
+  {
+    // bits per sample (side channel has one more)
+    unsigned b = bits;
+    if ( (assignment == LEFT_SIDE) && (c == 1) ) b++;
+    if ( (assignment == SIDE_RIGHT) && (c == 0) ) b++;
+    if ( (assignment == MID_SIDE) && (c == 1) ) b++;
+
+    // type
+    if (in.read(1) != 0) return false;
+    unsigned type = in.read(6);
+    if (in.read(1) != 0) return false;
+
+    vector<int64_t>& s = x[c];
+
+    // constant
+    if (type == 0)
+    {
+      int64_t value = in.readSigned(b);
+      for(unsigned i = 0; i < n; i++) s[i] = value;
+      continue;
+    }
+
+    // verbatim
+    if (type == 1)
+    {
+      for(unsigned i = 0; i < n; i++) s[i] = in.readSigned(b);
+      continue;
+    }
+
+    // predictor
+    bool     lpc   = (type & 32) != 0;
+    unsigned order = lpc ? (type & 31) + 1 : (type & 7);
+    if ( !lpc && (((type & ~7u) != 8) || (order > 4)) ) return false;
+    if (order > n) return false;
+
+    // warm-up samples
+    for(unsigned i = 0; i < order; i++) s[i] = in.readSigned(b);
+
+    // coefficients
+    unsigned        precision = 0;
+    unsigned        shift     = 0;
+    vector<int64_t> qlp;
+    if (lpc)
+    {
+      precision = in.read(4) + 1;
+      shift     = in.read(5);
+      for(unsigned j = 0; j < order; j++) qlp.push_back( in.readSigned(precision) );
+    }
+
+    // residual
+    unsigned method = in.read(2);
+    if (method > 1) return false;
+    unsigned partitionOrder = in.read(4);
+    unsigned partitionSize  = n >> partitionOrder;
+    if ( (partitionSize << partitionOrder) != n || (partitionSize < order) ) return false;
+
+    for(unsigned k = 0; k < (1u << partitionOrder); k++)
+    {
+      unsigned parameter = in.read(method ? 5 : 4);
+      if (parameter == (method ? 31u : 15u)) return false;
+
+      unsigned first = (k == 0) ? order : k * partitionSize;
+      unsigned last  = (k + 1) * partitionSize;
+      for(unsigned i = first; i < last; i++)
+      {
+        int64_t r = in.readRice(parameter);
+
+        if (lpc)
+        {
+          int64_t sum = 0;
+          for(unsigned j = 0; j < order; j++) sum += qlp[j] * s[i - j - 1];
+          s[i] = r + (sum >> shift);
+        }
+
+        else
+        {
+          s[i] = fixedValue(s, i, order, r);
+        }
+      }
+
+      if ( in.failed() ) return false;
+    }
+  }
+
+  // padding and checksum
+  in.align();
+  if ( in.failed() || (in.position() / 8 + 2 != frame.size()) ) return false;
+
+  // undo stereo decorrelation and interleave samples
+  samples.resize(size_t(n) * channels);
+  for(unsigned i = 0; i < n; i++)
+  {
+    int64_t a = x[0][i];
+    int64_t b = (channels > 1) ? x[1][i] : 0;
+
+    if (assignment == LEFT_SIDE)  { b = a - b; }
+    if (assignment == SIDE_RIGHT) { a = a + b; }
+    if (assignment == MID_SIDE)
+    {
+      int64_t mid = (a << 1) | (b & 1);
+      a = (mid + b) >> 1;
+      b = (mid - b) >> 1;
+    }
+
+    samples[size_t(i) * channels] = static_cast<int32_t>(a);
+    if (channels > 1) samples[size_t(i) * channels + 1] = static_cast<int32_t>(b);
+    for(unsigned c = 2; c < channels; c++)
+    {
+      samples[size_t(i) * channels + c] = static_cast<int32_t>(x[c][i]);
+    }
+  }
+
+  // signalize success
+  return true;
+}
+
+// ----------
+// streamInfo
+// ----------
+/*
+ *
+ */
+string FlacEncoder::streamInfo(unsigned minFrame, unsigned maxFrame, uint64_t total, const string& md5) const
+{
+  // the block size of all frames but the last one
+  unsigned size = ( (total > 0) && (total < blockSize) && (total >= 16) ) ? static_cast<unsigned>(total) : blockSize;
+
+  BitWriter out;
+
+  // header (not the last block)
+  out.write(0, 8);
+  out.write(34, 24);
+
+  // content
+  out.write(size, 16);
+  out.write(size, 16);
+  out.write(minFrame, 24);
+  out.write(maxFrame, 24);
+  out.write(m_format.rate, 20);
+  out.write(m_format.channels - 1, 3);
+  out.write(m_format.bits - 1, 5);
+  out.write(total, 36);
+
+  // digest
+  string info = out.data();
+  info += md5;
+
+  return info;
+}
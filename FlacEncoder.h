@@ -0,0 +1,260 @@
+// -----------------------------------------------------------------------------
+// FlacEncoder.h                                                   FlacEncoder.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref FlacEncoder class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef FLACENCODER_H_INCLUDE_NO1
+#define FLACENCODER_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <istream>
+#include "BitWriter.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------
+// FlacEncoder
+// -----------
+/**
+ * @brief  This class converts a wav file (PCM, 8, 16 or 24 bits, up to 8
+ *         channels) into a flac file.
+ *
+ * The frames of a track (4096 samples each) are encoded by several
+ * threads at once. Each subframe is stored as constant, verbatim, fixed
+ * or LPC (up to order 12) subframe, whatever is shortest; stereo tracks
+ * use the shortest of the four channel assignments. Every frame is
+ * decoded again in memory and compared with its samples before it is
+ * written (like flac --verify). The stream info holds the MD5 digest of
+ * the samples.
+ *
+ * The file gets a padding block of the given size behind the stream
+ * info, so comments and pictures can be set in place afterwards (see
+ * FlacFile).
+ */
+class FlacEncoder
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // -----------
+  // FlacEncoder
+  // -----------
+  /**
+   * @brief  The standard-constructor.
+   *
+   * @param threads  holds the number of frames encoded at once
+   *                 (0 means one frame per processor).
+   */
+  FlacEncoder(unsigned threads = 0);
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // ------
+  // encode
+  // ------
+  /**
+   * @brief  This method converts the given wav file into a flac file.
+   *
+   * @param wavfile   holds the name of the wav file.
+   * @param flacfile  holds the name of the flac file (overwritten).
+   * @param padding   holds the size of the padding block.
+   *
+   * @return  false if the wav file can't be read, the flac file can't be
+   *          written or a frame doesn't decode to its samples
+   */
+  bool encode(const string& wavfile, const string& flacfile, unsigned padding);
+
+
+protected:
+
+  // ---------------------------------------------------------------------------
+  // Types                                                                 Types
+  // ---------------------------------------------------------------------------
+
+  // ------
+  // Format
+  // ------
+  /**
+   * @brief  The format of the samples.
+   */
+  struct Format
+  {
+    /// the number of channels
+    unsigned channels;
+
+    /// the number of bits per sample
+    unsigned bits;
+
+    /// the number of samples per second
+    unsigned rate;
+  };
+
+  // --------
+  // Subframe
+  // --------
+  /**
+   * @brief  The encoding of one channel of a frame.
+   */
+  struct Subframe
+  {
+    /// the type of the subframe (CONSTANT, VERBATIM, FIXED or LPC)
+    unsigned type;
+
+    /// the number of bits per sample
+    unsigned bits;
+
+    /// the order of the predictor (FIXED, LPC)
+    unsigned order;
+
+    /// the precision of the coefficients (LPC)
+    unsigned precision;
+
+    /// the shift of the prediction (LPC)
+    unsigned shift;
+
+    /// the quantized coefficients (LPC)
+    vector<int32_t> coefficients;
+
+    /// the partition order of the residual
+    unsigned partitionOrder;
+
+    /// the rice parameter of each partition
+    vector<unsigned> parameters;
+
+    /// the residual (FIXED, LPC)
+    vector<int64_t> residual;
+
+    /// the (estimated) size in bits
+    uint64_t size;
+  };
+
+
+  // ---------------------------------------------------------------------------
+  // Internal methods                                           Internal methods
+  // ---------------------------------------------------------------------------
+
+  // ----------
+  // readHeader
+  // ----------
+  /**
+   * @brief  This method reads the format of the wav file up to its data.
+   *
+   * @return  false if the file is no supported wav file
+   */
+  bool readHeader(istream& in, uint64_t& size);
+
+  // -----------
+  // encodeFrame
+  // -----------
+  /**
+   * @brief  This method encodes (and verifies) one frame.
+   *
+   * @param samples  holds the interleaved samples of the frame.
+   * @param count    holds the number of samples per channel.
+   * @param number   holds the number of the frame.
+   * @param frame    returns the encoded frame.
+   *
+   * @return  false if the frame doesn't decode to its samples
+   */
+  bool encodeFrame(const int32_t* samples, unsigned count, uint64_t number, string& frame) const;
+
+  // --------------
+  // encodeSubframe
+  // --------------
+  /**
+   * @brief  This method finds the shortest encoding of one channel.
+   */
+  void encodeSubframe(const vector<int32_t>& x, unsigned bits, Subframe& sub) const;
+
+  // ------
+  // tryLPC
+  // ------
+  /**
+   * @brief  This method replaces the given encoding by an LPC subframe
+   *         if that is shorter.
+   */
+  void tryLPC(const vector<int32_t>& x, Subframe& sub) const;
+
+  // -----------
+  // fitResidual
+  // -----------
+  /**
+   * @brief  This method chooses partition order and rice parameters of
+   *         the residual and returns its (estimated) size in bits.
+   */
+  uint64_t fitResidual(const vector<int64_t>& residual, unsigned order, unsigned& partitionOrder, vector<unsigned>& parameters) const;
+
+  // -------------
+  // writeSubframe
+  // -------------
+  /**
+   * @brief  This method appends the given subframe.
+   */
+  void writeSubframe(BitWriter& out, const vector<int32_t>& x, const Subframe& sub) const;
+
+  // -----------
+  // decodeFrame
+  // -----------
+  /**
+   * @brief  This method decodes the given frame (as written by
+   *         encodeFrame()).
+   *
+   * @return  false if the frame is broken
+   */
+  bool decodeFrame(const string& frame, unsigned count, vector<int32_t>& samples) const;
+
+  // ----------
+  // streamInfo
+  // ----------
+  /**
+   * @brief  This method returns the stream info block (with header).
+   */
+  string streamInfo(unsigned minFrame, unsigned maxFrame, uint64_t total, const string& md5) const;
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the number of frames encoded at once
+  unsigned m_threads;
+
+  /// the format of the current wav file
+  Format m_format;
+
+  /// the window of full frames (LPC)
+  vector<double> m_window;
+
+};
+
+#endif  /* #ifndef FLACENCODER_H_INCLUDE_NO1 */
+
@@ -0,0 +1,644 @@
+// -----------------------------------------------------------------------------
+// FlacFile.cpp                                                     FlacFile.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref FlacFile class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "message.h"
+#include "imageinfo.h"
+#include "FlacFile.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------------------------------------------------------------------------
+// Helper functions                                             Helper functions
+// -----------------------------------------------------------------------------
+
+/// the padding of rewritten files
+static const unsigned newPadding = 8192;
+
+/// the largest size of a metadata block
+static const unsigned maxBlockSize = 0xFFFFFF;
+
+// ------------
+// littleEndian
+// ------------
+/*
+ * the 32 bit little endian number at position n
+ */
+static unsigned long littleEndian(const string& data, string::size_type n)
+{
+  unsigned long number = 0;
+
+  for(unsigned i = 4; i > 0; i--)
+  {
+    number = (number << 8) | static_cast<unsigned char>(data[n + i - 1]);
+  }
+
+  return number;
+}
+
+// ---------------
+// appendBigEndian
+// ---------------
+/*
+ * append number as big endian number of the given size
+ */
+static void appendBigEndian(string& data, unsigned long number, unsigned size)
+{
+  for(unsigned i = size; i > 0; i--)
+  {
+    data += static_cast<char>( (number >> (8 * (i - 1))) & 0xFF );
+  }
+}
+
+// ------------------
+// appendLittleEndian
+// ------------------
+/*
+ * append number as 32 bit little endian number
+ */
+static void appendLittleEndian(string& data, unsigned long number)
+{
+  for(unsigned i = 0; i < 4; i++)
+  {
+    data += static_cast<char>( (number >> (8 * i)) & 0xFF );
+  }
+}
+
+// ------------
+// appendHeader
+// ------------
+/*
+ * append the header of a metadata block
+ */
+static void appendHeader(string& data, unsigned type, unsigned long size, bool last)
+{
+  data += static_cast<char>( last ? (type | 0x80) : type );
+  appendBigEndian(data, size, 3);
+}
+
+// -------
+// isField
+// -------
+/*
+ * the comment has the given field name (case-insensitive)
+ */
+static bool isField(const string& comment, const string& name)
+{
+  // field name too short
+  if ( (comment.size() <= name.size()) || (comment[name.size()] != '=') ) return false;
+
+  // compare field names
+  for(string::size_type i = 0; i < name.size(); i++)
+  {
+    if ( toupper(static_cast<unsigned char>(comment[i]))
+    !=   toupper(static_cast<unsigned char>(name[i])) ) return false;
+  }
+
+  // field name matches
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// --------
+// FlacFile
+// --------
+/*
+ *
+ */
+FlacFile::FlacFile()
+: m_metasize(0)
+{
+  // nothing
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// ----
+// load
+// ----
+/*
+ *
+ */
+bool FlacFile::load(const string& filename)
+{
+  // reset metadata
+  m_filename = filename;
+  m_blocks.clear();
+  m_vendor.clear();
+  m_comments.clear();
+  m_metasize = 0;
+
+  // open file
+  ifstream file(filename.c_str(), ios::in | ios::binary);
+
+  if ( !file )
+  {
+    // notify user
+    msg::err( msg::catq("unable to open flac file: ", filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // check stream marker
+  char marker[4];
+  if ( !file.read(marker, 4) || (string(marker, 4) != "fLaC") )
+  {
+    // notify user
+    msg::err( msg::catq("this is no flac file: ", filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // the header of the current block
+  unsigned char header[4] = { 0, 0, 0, 0 };
+
+  // read all metadata blocks
+  while ( !(header[0] & 0x80) )
+  {
+    // read header
+    if ( !file.read(reinterpret_cast<char*>(header), 4) )
+    {
+      // notify user
+      msg::err( msg::catq("broken metadata: ", filename) );
+
+      // signalize trouble
+      return false;
+    }
+
+    // get type and size
+    Block block;
+    block.type = header[0] & 0x7F;
+    unsigned long size = (header[1] << 16) | (header[2] << 8) | header[3];
+
+    // read content
+    block.data.resize(size);
+    if ( (size > 0) && !file.read(&block.data[0], size) )
+    {
+      // notify user
+      msg::err( msg::catq("broken metadata: ", filename) );
+
+      // signalize trouble
+      return false;
+    }
+
+    // the space of this block
+    m_metasize += 4 + size;
+
+    // padding is recreated by save()
+    if (block.type == PADDING) continue;
+
+    // get comments
+    if ( (block.type == VORBIS_COMMENT) && !parseComments(block.data) )
+    {
+      // notify user
+      msg::err( msg::catq("broken comments: ", filename) );
+
+      // signalize trouble
+      return false;
+    }
+
+    // keep block
+    m_blocks.push_back(block);
+  }
+
+  // the first block must be the stream info
+  if ( m_blocks.empty() || (m_blocks[0].type != STREAMINFO) )
+  {
+    // notify user
+    msg::err( msg::catq("stream info missing: ", filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // signalize success
+  return true;
+}
+
+// ----
+// save
+// ----
+/*
+ *
+ */
+bool FlacFile::save()
+{
+  // get new metadata
+  string metadata;
+  if ( !buildBlocks(metadata) ) return false;
+
+  // new metadata doesn't fit into the old space
+  if ( (metadata.size() != m_metasize)
+  &&   ( (metadata.size() + 4 > m_metasize) || (m_metasize - metadata.size() - 4 > maxBlockSize) ) )
+  {
+    // append new padding
+    appendHeader(metadata, PADDING, newPadding, true);
+    metadata.append(newPadding, '\0');
+
+    // copy whole file
+    return rewrite(metadata);
+  }
+
+  // fill the remaining space with padding
+  if (metadata.size() < m_metasize)
+  {
+    // size of the padding
+    unsigned long size = m_metasize - metadata.size() - 4;
+
+    // append padding
+    appendHeader(metadata, PADDING, size, true);
+    metadata.append(size, '\0');
+  }
+
+  // mark last block
+  else
+  {
+    // find header of the last block
+    string::size_type pos = 0;
+    string::size_type last = 0;
+    while (pos < metadata.size())
+    {
+      last = pos;
+      pos += 4 + ( (static_cast<unsigned char>(metadata[pos + 1]) << 16)
+                 | (static_cast<unsigned char>(metadata[pos + 2]) << 8)
+                 |  static_cast<unsigned char>(metadata[pos + 3]) );
+    }
+
+    // set flag
+    metadata[last] = static_cast<char>(metadata[last] | 0x80);
+  }
+
+  // open file
+  int fd = open(m_filename.c_str(), O_WRONLY);
+
+  // write metadata behind the stream marker
+  ssize_t written = (fd == -1) ? -1 : pwrite(fd, metadata.data(), metadata.size(), 4);
+
+  // close file
+  if ( (fd == -1) || (close(fd) != 0) || (written != static_cast<ssize_t>(metadata.size())) )
+  {
+    // notify user
+    msg::err( msg::catq("unable to write flac file: ", m_filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // signalize success
+  return true;
+}
+
+// ---------
+// removeTag
+// ---------
+/*
+ *
+ */
+void FlacFile::removeTag(const string& name)
+{
+  // the number of kept comments
+  vector<string>::size_type count = 0;
+
+  // keep other comments
+  for(vector<string>::size_type i = 0; i < m_comments.size(); i++)
+  {
+    if ( !isField(m_comments[i], name) ) m_comments[count++].swap(m_comments[i]);
+  }
+
+  // remove the rest
+  m_comments.resize(count);
+}
+
+// ------
+// addTag
+// ------
+/*
+ *
+ */
+void FlacFile::addTag(const string& name, const string& value)
+{
+  m_comments.push_back(name + "=" + value);
+}
+
+// ----------
+// setPicture
+// ----------
+/*
+ *
+ */
+bool FlacFile::setPicture(unsigned type, const string& imagefile)
+{
+  // the content and properties of the image
+  string data;
+  imageinfo::Info info;
+
+  // read image
+  if ( !imageinfo::load(imagefile, data) || !imageinfo::inspect(data, info) )
+  {
+    // notify user
+    msg::err( msg::catq("unable to read image: ", imagefile) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // create block
+  Block block;
+  block.type = PICTURE;
+  appendBigEndian(block.data, type, 4);
+  appendBigEndian(block.data, info.mime.size(), 4);
+  block.data += info.mime;
+  appendBigEndian(block.data, 0, 4);
+  appendBigEndian(block.data, info.width, 4);
+  appendBigEndian(block.data, info.height, 4);
+  appendBigEndian(block.data, info.depth, 4);
+  appendBigEndian(block.data, info.colors, 4);
+  appendBigEndian(block.data, data.size(), 4);
+  block.data += data;
+
+  // the number of kept blocks
+  vector<Block>::size_type count = 0;
+
+  // remove pictures of the same type
+  for(vector<Block>::size_type i = 0; i < m_blocks.size(); i++)
+  {
+    // get type of picture
+    unsigned long ptype = 0;
+    if ( (m_blocks[i].type == PICTURE) && (m_blocks[i].data.size() >= 4) )
+    {
+      for(unsigned k = 0; k < 4; k++)
+      {
+        ptype = (ptype << 8) | static_cast<unsigned char>(m_blocks[i].data[k]);
+      }
+    }
+
+    // keep other blocks
+    if ( (m_blocks[i].type != PICTURE) || (ptype != type) )
+    {
+      if (count != i) m_blocks[count] = m_blocks[i];
+      count++;
+    }
+  }
+
+  // remove the rest
+  m_blocks.resize(count);
+
+  // append picture
+  m_blocks.push_back(block);
+
+  // signalize success
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Status information                                         Status information
+// -----------------------------------------------------------------------------
+
+// --------
+// comments
+// --------
+/*
+ *
+ */
+const vector<string>& FlacFile::comments() const
+{
+  return m_comments;
+}
+
+// -----
+// value
+// -----
+/*
+ *
+ */
+bool FlacFile::value(const string& name, string& value) const
+{
+  // search comment
+  for(vector<string>::size_type i = 0; i < m_comments.size(); i++)
+  {
+    if ( isField(m_comments[i], name) )
+    {
+      // get value
+      value = m_comments[i].substr(name.size() + 1);
+
+      // signalize success
+      return true;
+    }
+  }
+
+  // comment not found
+  return false;
+}
+
+
+// -----------------------------------------------------------------------------
+// Internal methods                                             Internal methods
+// -----------------------------------------------------------------------------
+
+// -------------
+// parseComments
+// -------------
+/*
+ * <vendor size> <vendor> <count> { <comment size> <comment> } (little endian)
+ */
+bool FlacFile::parseComments(const string& data)
+{
+  // the current position
+  string::size_type pos = 0;
+
+  // get vendor
+  if (data.size() < pos + 4) return false;
+  unsigned long size = littleEndian(data, pos);
+  pos += 4;
+
+  if (data.size() - pos < size) return false;
+  m_vendor = data.substr(pos, size);
+  pos += size;
+
+  // get number of comments
+  if (data.size() < pos + 4) return false;
+  unsigned long count = littleEndian(data, pos);
+  pos += 4;
+
+  // get comments
+  for(unsigned long i = 0; i < count; i++)
+  {
+    if (data.size() < pos + 4) return false;
+    size = littleEndian(data, pos);
+    pos += 4;
+
+    if (data.size() - pos < size) return false;
+    m_comments.push_back( data.substr(pos, size) );
+    pos += size;
+  }
+
+  // signalize success
+  return true;
+}
+
+// -----------
+// buildBlocks
+// -----------
+/*
+ *
+ */
+bool FlacFile::buildBlocks(string& metadata) const
+{
+  // reset return value
+  metadata.clear();
+
+  // create comment block
+  Block comments;
+  comments.type = VORBIS_COMMENT;
+  appendLittleEndian(comments.data, m_vendor.size());
+  comments.data += m_vendor;
+  appendLittleEndian(comments.data, m_comments.size());
+  for(vector<string>::size_type i = 0; i < m_comments.size(); i++)
+  {
+    appendLittleEndian(comments.data, m_comments[i].size());
+    comments.data += m_comments[i];
+  }
+
+  // the comment block has been written
+  bool written = false;
+
+  // append all blocks
+  for(vector<Block>::size_type i = 0; i <= m_blocks.size(); i++)
+  {
+    // the block to append
+    const Block* block = (i < m_blocks.size()) ? &m_blocks[i] : 0;
+
+    // replace old comments
+    if ( block && (block->type == VORBIS_COMMENT) )
+    {
+      block = written ? 0 : &comments;
+      written = true;
+    }
+
+    // add new comments behind the stream info (resp. at the end)
+    else if ( !written && (i == 1) )
+    {
+      i--;
+      block = &comments;
+      written = true;
+    }
+
+    // nothing to append
+    if (block == 0) continue;
+
+    // check size
+    if (block->data.size() > maxBlockSize)
+    {
+      // notify user
+      msg::err( msg::catq("metadata block too large: ", m_filename) );
+
+      // signalize trouble
+      return false;
+    }
+
+    // append block (the last flag is set by save())
+    appendHeader(metadata, block->type, block->data.size(), false);
+    metadata += block->data;
+  }
+
+  // signalize success
+  return true;
+}
+
+// -------
+// rewrite
+// -------
+/*
+ *
+ */
+bool FlacFile::rewrite(const string& metadata) const
+{
+  // open original file
+  ifstream in(m_filename.c_str(), ios::in | ios::binary);
+
+  // get state of original file
+  struct stat info;
+  bool ok = in && (stat(m_filename.c_str(), &info) == 0);
+
+  // create temporary file in the same directory
+  string tempname = m_filename + ".XXXXXX";
+  int fd = ok ? mkstemp(&tempname[0]) : -1;
+
+  if (fd == -1)
+  {
+    // notify user
+    msg::err( msg::catq("unable to create temporary file for: ", m_filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // keep permissions
+  fchmod(fd, info.st_mode & 07777);
+
+  // write stream marker and metadata
+  string buffer = "fLaC" + metadata;
+  ok = (write(fd, buffer.data(), buffer.size()) == static_cast<ssize_t>(buffer.size()));
+
+  // skip old metadata
+  in.seekg(4 + m_metasize);
+
+  // copy audio frames
+  buffer.resize(65536);
+  while ( ok && (in.read(&buffer[0], buffer.size()) || (in.gcount() > 0)) )
+  {
+    ssize_t count = in.gcount();
+    ok = (write(fd, buffer.data(), count) == count);
+  }
+
+  // check read state
+  if ( in.bad() ) ok = false;
+
+  // close temporary file and replace original file
+  if ( (close(fd) != 0) || !ok || (rename(tempname.c_str(), m_filename.c_str()) != 0) )
+  {
+    // remove temporary file
+    unlink( tempname.c_str() );
+
+    // notify user
+    msg::err( msg::catq("unable to write flac file: ", m_filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // signalize success
+  return true;
+}
+
@@ -0,0 +1,219 @@
+// -----------------------------------------------------------------------------
+// FlacFile.h                                                         FlacFile.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref FlacFile class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef FLACFILE_H_INCLUDE_NO1
+#define FLACFILE_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <vector>
+#include <string>
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// --------
+// FlacFile
+// --------
+/**
+ * @brief  This class reads and writes the metadata blocks of a flac file
+ *         (comments and pictures).
+ *
+ * The metadata is rewritten in place if it fits into the space of the
+ * old metadata (including its padding). Otherwise the whole file is
+ * copied with new padding.
+ */
+class FlacFile
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // --------
+  // FlacFile
+  // --------
+  /**
+   * @brief  The standard-constructor.
+   */
+  FlacFile();
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // ----
+  // load
+  // ----
+  /**
+   * @brief  This method reads the metadata of the given flac file.
+   */
+  bool load(const string& filename);
+
+  // ----
+  // save
+  // ----
+  /**
+   * @brief  This method writes the (modified) metadata back to the file.
+   */
+  bool save();
+
+  // ---------
+  // removeTag
+  // ---------
+  /**
+   * @brief  This method removes all comments of the given name.
+   */
+  void removeTag(const string& name);
+
+  // ------
+  // addTag
+  // ------
+  /**
+   * @brief  This method appends the given comment.
+   */
+  void addTag(const string& name, const string& value);
+
+  // ----------
+  // setPicture
+  // ----------
+  /**
+   * @brief  This method replaces the pictures of the given type by the
+   *         given image (JPEG or PNG).
+   */
+  bool setPicture(unsigned type, const string& imagefile);
+
+
+  // ---------------------------------------------------------------------------
+  // Status information                                       Status information
+  // ---------------------------------------------------------------------------
+
+  // --------
+  // comments
+  // --------
+  /**
+   * @brief  This method returns all comments ("NAME=value").
+   */
+  const vector<string>& comments() const;
+
+  // -----
+  // value
+  // -----
+  /**
+   * @brief  This method returns the value of the first comment of the
+   *         given name.
+   *
+   * @return  false if there is no such comment
+   */
+  bool value(const string& name, string& value) const;
+
+
+protected:
+
+  // ---------------------------------------------------------------------------
+  // Types                                                                 Types
+  // ---------------------------------------------------------------------------
+
+  /// the types of metadata blocks
+  enum
+  {
+    STREAMINFO     = 0,
+    PADDING        = 1,
+    VORBIS_COMMENT = 4,
+    PICTURE        = 6
+  };
+
+  // -----
+  // Block
+  // -----
+  /**
+   * @brief  A metadata block.
+   */
+  struct Block
+  {
+    /// the type of the block
+    unsigned type;
+
+    /// the content of the block (without header)
+    string data;
+  };
+
+
+  // ---------------------------------------------------------------------------
+  // Internal methods                                           Internal methods
+  // ---------------------------------------------------------------------------
+
+  // -------------
+  // parseComments
+  // -------------
+  /**
+   * @brief  This method reads vendor and comments of a VORBIS_COMMENT block.
+   */
+  bool parseComments(const string& data);
+
+  // -----------
+  // buildBlocks
+  // -----------
+  /**
+   * @brief  This method returns all metadata blocks (with headers) except
+   *         for padding.
+   *
+   * @return  false if a block is too large
+   */
+  bool buildBlocks(string& metadata) const;
+
+  // -------
+  // rewrite
+  // -------
+  /**
+   * @brief  This method copies the file with the given metadata and
+   *         replaces the original file.
+   */
+  bool rewrite(const string& metadata) const;
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the name of the flac file
+  string m_filename;
+
+  /// all metadata blocks except for padding
+  vector<Block> m_blocks;
+
+  /// the vendor string of the comments
+  string m_vendor;
+
+  /// all comments ("NAME=value")
+  vector<string> m_comments;
+
+  /// the number of bytes between "fLaC" and the first audio frame
+  unsigned long long m_metasize;
+
+};
+
+#endif  /* #ifndef FLACFILE_H_INCLUDE_NO1 */
+
@@ -19,7 +19,9 @@
 // -----------------------------------------------------------------------------
 // Includes                                                             Includes
 // -----------------------------------------------------------------------------
+#include <vector>
 #include <string>
+#include <unordered_map>
 #include "ChainHandler.h"
 
 
@@ -71,11 +73,43 @@ public:
   /**
    *
    */
-  virtual void OnData(const string& key, const string& value);
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
 
 
 protected:
 
+  // ---------------------------------------------------------------------------
+  // Types                                                                 Types
+  // ---------------------------------------------------------------------------
+
+  // -----------
+  // Instruction
+  // -----------
+  /**
+   * @brief  One step of a compiled format string.
+   *
+   * The argument of a CALL is made of the @a size instructions that
+   * follow the call.
+   */
+  struct Instruction
+  {
+    /// LITERAL, CALL or FAIL
+    unsigned char op;
+
+    /// the name of the format command (CALL)
+    unsigned char function;
+
+    /// the quantifier of the format command (CALL)
+    unsigned number;
+
+    /// the number of instructions of the argument (CALL)
+    size_t size;
+
+    /// the text (LITERAL) or the error message (FAIL, CALL)
+    string text;
+  };
+
+
   // ---------------------------------------------------------------------------
   // Internal methods                                           Internal methods
   // ---------------------------------------------------------------------------
@@ -84,9 +118,51 @@ protected:
   // format
   // ------
   /**
+   * @brief  This method formats the given text.
+   *
+   * Each text is compiled once and the resulting program is cached.
+   */
+  bool format(const string& text, string& formatted);
+
+  // -------
+  // compile
+  // -------
+  /**
+   * @brief  This method translates a format string into instructions.
    *
+   * Syntax errors don't stop the compilation, they become FAIL
+   * instructions at the position they were found. So the messages
+   * appear in the same order as when the text is interpreted directly.
    */
-  bool format(const string& text, string& formatted) const;
+  void compile(const string& text, vector<Instruction>& code) const;
+
+  // ----
+  // emit
+  // ----
+  /**
+   *
+   */
+  void emit(vector<Instruction>& code, unsigned char op, const string& text) const;
+
+  // --------
+  // toNumber
+  // --------
+  /**
+   *
+   */
+  bool toNumber(const string& digits, unsigned& number) const;
+
+  // ---
+  // run
+  // ---
+  /**
+   * @brief  This method executes the instructions [begin, end).
+   */
+  bool run( const vector<Instruction>&  code,
+            size_t                      begin,
+            size_t                      end,
+            string&                     formatted
+          ) const;
 
   // --------
   // evaluate
@@ -95,7 +171,7 @@ protected:
    *
    */
   bool evaluate( unsigned char  function,
-                 const string&  quantifier,
+                 unsigned       number,
                  const string&  argument,
                  string&        result
                ) const;
@@ -156,6 +232,16 @@ protected:
    */
   bool fmtFilename(unsigned number, const string& in, string& out) const;
 
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the compiled format strings of the current file
+  unordered_map<string, vector<Instruction> > m_programs;
+
 };
 
 #endif  /* #ifndef FORMATHANDLER_H_INCLUDE_NO1 */
@@ -0,0 +1,415 @@
+// -----------------------------------------------------------------------------
+// HtmlHandler.cpp                                               HtmlHandler.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref HtmlHandler class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <sys/stat.h>
+#include "utf8.h"
+#include "message.h"
+#include "keyinfo.h"
+#include "OutputSink.h"
+#include "HtmlHandler.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------------------------------------------------------------------------
+// Helper functions                                             Helper functions
+// -----------------------------------------------------------------------------
+
+// ------
+// escape
+// ------
+/*
+ * replaces the special html characters &, < and >
+ */
+static string escape(const string& text)
+{
+  string result;
+  result.reserve( text.size() );
+
+  for(string::size_type i = 0; i < text.size(); i++)
+  {
+    if      (text[i] == '&') result += "&amp;";
+    else if (text[i] == '<') result += "&lt;";
+    else if (text[i] == '>') result += "&gt;";
+    else                     result += text[i];
+  }
+
+  return result;
+}
+
+// --------
+// pagename
+// --------
+/*
+ * "dir/name.cd" is "dir/name.html"
+ */
+static string pagename(const string& filename)
+{
+  // find extension (in the last component)
+  string::size_type dot   = filename.rfind('.');
+  string::size_type slash = filename.rfind('/');
+
+  // strip extension
+  if ( (dot != string::npos) && (dot + 1 < filename.size()) && ((slash == string::npos) || (dot > slash)) )
+  {
+    return filename.substr(0, dot) + ".html";
+  }
+
+  return filename + ".html";
+}
+
+// --------
+// basename
+// --------
+/*
+ * "dir/name.cd" is "name.cd"
+ */
+static string basename(const string& filename)
+{
+  // find last slash
+  string::size_type slash = filename.rfind('/');
+
+  return (slash == string::npos) ? filename : filename.substr(slash + 1);
+}
+
+// -------
+// isOlder
+// -------
+/*
+ * a missing file is older than any other file
+ */
+static bool isOlder(const string& filename, const struct stat& other)
+{
+  // the state of the file
+  struct stat info;
+
+  // file is missing
+  if (stat(filename.c_str(), &info) != 0) return true;
+
+  // compare times of last modification
+  if (info.st_mtim.tv_sec != other.st_mtim.tv_sec) return info.st_mtim.tv_sec < other.st_mtim.tv_sec;
+  return info.st_mtim.tv_nsec < other.st_mtim.tv_nsec;
+}
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// -----------
+// HtmlHandler
+// -----------
+/*
+ *
+ */
+HtmlHandler::HtmlHandler()
+{
+  // initialization
+}
+
+
+// -----------------------------------------------------------------------------
+// Callback handler                                             Callback handler
+// -----------------------------------------------------------------------------
+
+// --------------
+// OnBeginParsing
+// --------------
+/*
+ *
+ */
+void HtmlHandler::OnBeginParsing(const string& filename)
+{
+  // set current filename
+  m_filename = filename;
+
+  // empty buffers
+  m_track.clear();
+  m_seen.clear();
+
+  // update healthy flag
+  setHealthy( writePage() );
+}
+
+// ------------
+// OnEndParsing
+// ------------
+/*
+ *
+ */
+void HtmlHandler::OnEndParsing(bool healthy)
+{
+  // reset filename
+  m_filename = "";
+
+  // empty buffers
+  m_track.clear();
+  m_seen.clear();
+}
+
+// ------
+// OnData
+// ------
+/*
+ *
+ */
+void HtmlHandler::OnData(unsigned keyID, const string& key, const string& value)
+{
+  // don't run in bad state
+  if ( !healthy() ) return;
+
+  // buffer tag
+  m_track.add(keyID, key, value);
+
+  // trigger found
+  if (keyID == keyinfo::COMPILATIONINDEX)
+  {
+    // collect album
+    addRow();
+
+    // empty buffers
+    m_track.clear();
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// --------
+// moveRows
+// --------
+/*
+ *
+ */
+void HtmlHandler::moveRows(vector< vector<string> >& rows)
+{
+  // append rows
+  for(size_t i = 0; i < m_rows.size(); i++)
+  {
+    rows.push_back( vector<string>() );
+    rows.back().swap(m_rows[i]);
+  }
+
+  // empty list
+  m_rows.clear();
+}
+
+// ----------
+// writeIndex
+// ----------
+/*
+ * rows that compare equal keep their order
+ */
+bool HtmlHandler::writeIndex(const string& filename, const vector< vector<string> >& rows)
+{
+  // get sort keys (artist, album, file)
+  vector< vector<string> > keys( rows.size() );
+  for(size_t i = 0; i < rows.size(); i++)
+  {
+    keys[i].push_back( utf8::collationKey(rows[i][1]) );
+    keys[i].push_back( utf8::collationKey(rows[i][2]) );
+    keys[i].push_back( utf8::collationKey(rows[i][0]) );
+  }
+
+  // the positions of the rows in output order
+  vector<size_t> positions( rows.size() );
+  for(size_t i = 0; i < positions.size(); i++)
+  {
+    positions[i] = i;
+  }
+
+  // sort rows
+  stable_sort(positions.begin(), positions.end(), [&](size_t a, size_t b)
+  {
+    return keys[a] < keys[b];
+  });
+
+  // open file for writing
+  OutputSink sink;
+
+  // check if file has been opened
+  if ( !sink.open(filename) )
+  {
+    // notify user
+    msg::err( msg::catq("unable to open file: ", filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // buffered stream
+  ostream out(&sink);
+
+  out << "<!doctype html>" << '\n';
+  out << "<html lang=\"en\">" << '\n';
+  out << "<head>" << '\n';
+  out << "<meta charset=\"utf-8\" />" << '\n';
+  out << "<title>dbindex</title>" << '\n';
+  out << "</head>" << '\n';
+  out << "<body style=\"font-family:sans-serif; font-size:small\">" << '\n';
+  out << "<ul>" << '\n';
+
+  // one link per album
+  for(size_t i = 0; i < positions.size(); i++)
+  {
+    const vector<string>& row = rows[ positions[i] ];
+
+    out << "<li><a href=\"" << escape( pagename(row[0]) ) << "\" target=\"_blank\">"
+        << escape(row[1]) << " - " << escape(row[2]) << "</a></li>" << '\n';
+  }
+
+  out << "</ul>" << '\n';
+  out << "</body>" << '\n';
+  out << "</html>" << '\n';
+
+  // check state of stream (and write remaining data)
+  if ( !out || !sink.close() )
+  {
+    // notify user
+    msg::err( msg::catq("unable to write file: ", filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // signalize success
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Internal methods                                             Internal methods
+// -----------------------------------------------------------------------------
+
+// ---------
+// writePage
+// ---------
+/*
+ *
+ */
+bool HtmlHandler::writePage() const
+{
+  // the state of the current file
+  struct stat info;
+  if (stat(m_filename.c_str(), &info) != 0)
+  {
+    // notify user
+    msg::err( msg::catq("unable to open file: ", m_filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // get name of the page
+  string page = pagename(m_filename);
+
+  // page is up to date
+  if ( !isOlder(page, info) ) return true;
+
+  // show progress
+  msg::nfo( msg::catq("creating source file: ", page) );
+
+  // read content of the current file
+  stringstream content;
+  ifstream     in(m_filename.c_str(), ios::in | ios::binary);
+  content << in.rdbuf();
+
+  // check state
+  if ( !in )
+  {
+    // notify user
+    msg::err( msg::catq("unable to read file: ", m_filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // open page for writing
+  OutputSink sink;
+
+  // check if page has been opened
+  if ( !sink.open(page) )
+  {
+    // notify user
+    msg::err( msg::catq("unable to open file: ", page) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // buffered stream
+  ostream out(&sink);
+
+  out << "<!doctype html>" << '\n';
+  out << "<html lang=\"en\">" << '\n';
+  out << "<head>" << '\n';
+  out << "<meta charset=\"utf-8\" />" << '\n';
+  out << "<title>" << escape( basename(m_filename) ) << "</title>" << '\n';
+  out << "</head>" << '\n';
+  out << "<body>" << '\n';
+  out << "<pre>" << '\n';
+  out << escape( content.str() );
+  out << "</pre>" << '\n';
+  out << "</body>" << '\n';
+  out << "</html>" << '\n';
+
+  // check state of stream (and write remaining data)
+  if ( !out || !sink.close() )
+  {
+    // notify user
+    msg::err( msg::catq("unable to write file: ", page) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // signalize success
+  return true;
+}
+
+// ------
+// addRow
+// ------
+/*
+ *
+ */
+void HtmlHandler::addRow()
+{
+  // get columns
+  vector<string> row;
+  row.push_back(m_filename);
+  row.push_back( m_track.get(keyinfo::ALBUMARTIST) );
+  row.push_back( m_track.get(keyinfo::ALBUM) );
+
+  // skip albums without artist (resp. name)
+  if ( row[1].empty() || row[2].empty() ) return;
+
+  // join columns
+  string joined = row[1] + '\0' + row[2];
+
+  // album collected before
+  if ( !m_seen.insert(joined).second ) return;
+
+  // add row
+  m_rows.push_back(row);
+}
@@ -0,0 +1,172 @@
+// -----------------------------------------------------------------------------
+// HtmlHandler.h                                                   HtmlHandler.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref HtmlHandler class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef HTMLHANDLER_H_INCLUDE_NO1
+#define HTMLHANDLER_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include <unordered_set>
+#include "KVHandler.h"
+#include "TrackRecord.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------
+// HtmlHandler
+// -----------
+/**
+ * @brief  This class writes the html page of each parsed file and collects
+ *         the albums of the html index.
+ *
+ * The page of "dir/name.cd" is "dir/name.html". It holds the escaped
+ * content of the file and is only written if it is missing or older than
+ * the file. Each album is a row (name of the file, ALBUMARTIST, ALBUM);
+ * albums without artist (resp. name) are skipped.
+ */
+class HtmlHandler : public KVHandler
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // -----------
+  // HtmlHandler
+  // -----------
+  /**
+   * @brief  The standard-constructor.
+   */
+  HtmlHandler();
+
+
+  // ---------------------------------------------------------------------------
+  // Callback handler                                           Callback handler
+  // ---------------------------------------------------------------------------
+
+  // --------------
+  // OnBeginParsing
+  // --------------
+  /**
+   *
+   */
+  virtual void OnBeginParsing(const string& filename);
+
+  // ------------
+  // OnEndParsing
+  // ------------
+  /**
+   *
+   */
+  virtual void OnEndParsing(bool healthy);
+
+  // ------
+  // OnData
+  // ------
+  /**
+   *
+   */
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // --------
+  // moveRows
+  // --------
+  /**
+   * @brief  This method appends the rows collected so far to the given
+   *         list and empties the handler's list.
+   *
+   * @param rows  holds the list that receives the rows.
+   */
+  void moveRows(vector< vector<string> >& rows);
+
+  // ----------
+  // writeIndex
+  // ----------
+  /**
+   * @brief  This method writes the html index of the given rows.
+   *
+   * The albums are listed once, ordered by artist, album and file (the
+   * values are compared by the collation of the current locale).
+   *
+   * @param filename  holds the name of the index file.
+   * @param rows      holds the rows collected by moveRows().
+   *
+   * @return  false if the file can't be written
+   */
+  static bool writeIndex(const string& filename, const vector< vector<string> >& rows);
+
+
+protected:
+
+  // ---------------------------------------------------------------------------
+  // Internal methods                                           Internal methods
+  // ---------------------------------------------------------------------------
+
+  // ---------
+  // writePage
+  // ---------
+  /**
+   * @brief  This method writes the html page of the current file (if it
+   *         is missing or outdated).
+   *
+   * @return  false if the page can't be written
+   */
+  bool writePage() const;
+
+  // ------
+  // addRow
+  // ------
+  /**
+   * @brief  This method adds the album of the buffered track.
+   */
+  void addRow();
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the file that is currently parsed
+  string m_filename;
+
+  /// the tags of the current track
+  TrackRecord m_track;
+
+  /// the rows collected so far
+  vector< vector<string> > m_rows;
+
+  /// the rows collected so far (columns separated by NUL)
+  unordered_set<string> m_seen;
+
+};
+
+#endif  /* #ifndef HTMLHANDLER_H_INCLUDE_NO1 */
@@ -0,0 +1,501 @@
+// -----------------------------------------------------------------------------
+// ImageHandler.cpp                                             ImageHandler.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref ImageHandler class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "MD5.h"
+#include "message.h"
+#include "keyinfo.h"
+#include "OutputSink.h"
+#include "ImageHandler.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------------------------------------------------------------------------
+// Helper functions                                             Helper functions
+// -----------------------------------------------------------------------------
+
+/// the first bytes of an image
+static const char imageMagic[8] = { 'R', 'I', 'P', 'G', 'E', 'N', 'I', 'M' };
+
+/// the version of the format (change it whenever the tracks change)
+static const uint32_t imageVersion = 2;
+
+/// the size of the header
+static const uint64_t headerSize = 64;
+
+/// the position of the digest of the tables and the pool
+static const uint64_t digestOffset = 48;
+
+// ---------
+// imageName
+// ---------
+/*
+ * "name.cd" is "name.cd.bin"
+ */
+static string imageName(const string& filename)
+{
+  return filename + ".bin";
+}
+
+// ------
+// putU32
+// ------
+/*
+ * little endian
+ */
+static void putU32(string& out, uint32_t value)
+{
+  for(unsigned i = 0; i < 4; i++)
+  {
+    out += static_cast<char>( (value >> (8 * i)) & 0xFF );
+  }
+}
+
+// ------
+// putU64
+// ------
+/*
+ * little endian
+ */
+static void putU64(string& out, uint64_t value)
+{
+  putU32( out, static_cast<uint32_t>(value) );
+  putU32( out, static_cast<uint32_t>(value >> 32) );
+}
+
+// ------
+// getU32
+// ------
+/*
+ * little endian
+ */
+static uint32_t getU32(const unsigned char* data)
+{
+  return  static_cast<uint32_t>(data[0])
+       | (static_cast<uint32_t>(data[1]) <<  8)
+       | (static_cast<uint32_t>(data[2]) << 16)
+       | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+// ------
+// getU64
+// ------
+/*
+ * little endian
+ */
+static uint64_t getU64(const unsigned char* data)
+{
+  return static_cast<uint64_t>( getU32(data) ) | (static_cast<uint64_t>( getU32(data + 4) ) << 32);
+}
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// ------------
+// ImageHandler
+// ------------
+/*
+ *
+ */
+ImageHandler::ImageHandler()
+: m_stamped(false),
+  m_complete(false),
+  m_size(0),
+  m_sec(0),
+  m_nsec(0)
+{
+  // initialization
+}
+
+
+// -----------------------------------------------------------------------------
+// Callback handler                                             Callback handler
+// -----------------------------------------------------------------------------
+
+// --------------
+// OnBeginParsing
+// --------------
+/*
+ *
+ */
+void ImageHandler::OnBeginParsing(const string& filename)
+{
+  // update healthy flag
+  setHealthy();
+
+  // set current filename
+  m_filename = filename;
+
+  // nothing parsed yet
+  m_complete = false;
+
+  // empty buffers
+  m_track.clear();
+  m_tracks.clear();
+  m_tags.clear();
+  m_pool.clear();
+  m_offsets.clear();
+
+  // stamp file (stdin has no image)
+  struct stat info;
+  m_stamped = !filename.empty() && (stat(filename.c_str(), &info) == 0) && S_ISREG(info.st_mode);
+
+  if (m_stamped)
+  {
+    m_size = info.st_size;
+    m_sec  = info.st_mtim.tv_sec;
+    m_nsec = info.st_mtim.tv_nsec;
+  }
+}
+
+// ------------
+// OnEndParsing
+// ------------
+/*
+ *
+ */
+void ImageHandler::OnEndParsing(bool healthy)
+{
+  // the image is written by commit()
+  m_complete = healthy && this->healthy();
+
+  // empty buffers
+  m_track.clear();
+}
+
+// ------
+// OnData
+// ------
+/*
+ *
+ */
+void ImageHandler::OnData(unsigned keyID, const string& key, const string& value)
+{
+  // don't run in bad state
+  if ( !healthy() ) return;
+
+  // buffer tag
+  m_track.add(keyID, key, value);
+
+  // trigger found
+  if (keyID == keyinfo::COMPILATIONINDEX)
+  {
+    // add track to image
+    addTrack();
+
+    // empty buffers
+    m_track.clear();
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// ------
+// replay
+// ------
+/*
+ * the image is checked completely before the first tag is sent
+ */
+bool ImageHandler::replay(const string& filename, KVHandler* handler)
+{
+  // get state of the source file
+  struct stat source;
+  if ( filename.empty() || (stat(filename.c_str(), &source) != 0) ) return false;
+
+  // open image
+  int fd = open(imageName(filename).c_str(), O_RDONLY);
+  if (fd < 0) return false;
+
+  // get size of the image
+  struct stat info;
+  if ( (fstat(fd, &info) != 0) || !S_ISREG(info.st_mode) || (static_cast<uint64_t>(info.st_size) < headerSize) )
+  {
+    close(fd);
+    return false;
+  }
+
+  // map image
+  void* mapped = mmap(0, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+
+  if (mapped == MAP_FAILED) return false;
+
+  // abbreviations
+  const unsigned char* data = static_cast<const unsigned char*>(mapped);
+  uint64_t             size = info.st_size;
+
+  // read header
+  uint32_t version    = getU32(data +  8);
+  uint32_t trackCount = getU32(data + 12);
+  uint32_t tagCount   = getU32(data + 16);
+  uint32_t poolSize   = getU32(data + 20);
+
+  // get positions of the tables
+  const unsigned char* tracks = data   + headerSize;
+  const unsigned char* tags   = tracks + 4 * (static_cast<uint64_t>(trackCount) + 1);
+  const unsigned char* pool   = tags   + 16 * static_cast<uint64_t>(tagCount);
+
+  // check header (image of this format and of the current source file)
+  bool fresh = (memcmp(data, imageMagic, sizeof(imageMagic)) == 0)
+            && (version == imageVersion)
+            && (size == headerSize + 4 * (static_cast<uint64_t>(trackCount) + 1) + 16 * static_cast<uint64_t>(tagCount) + poolSize)
+            && (getU64(data + 24) == static_cast<uint64_t>(source.st_size))
+            && (getU64(data + 32) == static_cast<uint64_t>(source.st_mtim.tv_sec))
+            && (getU32(data + 40) == static_cast<uint32_t>(source.st_mtim.tv_nsec));
+
+  // check tables
+  for(uint32_t t = 0; fresh && (t < trackCount); t++)
+  {
+    // tracks are in order
+    fresh = ( getU32(tracks + 4 * t) <= getU32(tracks + 4 * (t + 1)) );
+  }
+
+  // all tags are part of a track
+  fresh = fresh && ( getU32(tracks) == 0 ) && ( getU32(tracks + 4 * trackCount) == tagCount );
+
+  // check digest of tables and pool (a damaged image is stale)
+  if (fresh)
+  {
+    MD5 md5;
+    md5.update( reinterpret_cast<const char*>(tracks), size - headerSize );
+    fresh = ( md5.digest().compare( 0, 16, reinterpret_cast<const char*>(data + digestOffset), 16 ) == 0 );
+  }
+
+  for(uint32_t n = 0; fresh && (n < tagCount); n++)
+  {
+    // abbreviation
+    const unsigned char* tag = tags + 16 * n;
+
+    // strings are part of the pool
+    fresh = ( static_cast<uint64_t>( getU32(tag    ) ) + getU32(tag +  4) <= poolSize )
+         && ( static_cast<uint64_t>( getU32(tag + 8) ) + getU32(tag + 12) <= poolSize );
+  }
+
+  // stale (resp. broken) image
+  if ( !fresh )
+  {
+    munmap(mapped, size);
+    return false;
+  }
+
+  // send message
+  handler->OnBeginParsing(filename);
+
+  // the current value
+  string value;
+
+  // send tags
+  for(uint32_t t = 0; t < trackCount; t++)
+  {
+    for(uint32_t n = getU32(tracks + 4 * t); n < getU32(tracks + 4 * (t + 1)); n++)
+    {
+      // abbreviation
+      const unsigned char* tag = tags + 16 * n;
+
+      // get key and value
+      const char* key = reinterpret_cast<const char*>( pool + getU32(tag) );
+      unsigned keyID  = m_keys.intern( string(key, getU32(tag + 4)) );
+
+      value.assign( reinterpret_cast<const char*>( pool + getU32(tag + 8) ), getU32(tag + 12) );
+
+      // send tag
+      handler->OnData(keyID, m_keys.name(keyID), value);
+    }
+  }
+
+  // send message
+  handler->OnEndParsing(true);
+
+  // unmap image
+  munmap(mapped, size);
+
+  // signalize success
+  return true;
+}
+
+
+// ------
+// commit
+// ------
+/*
+ *
+ */
+bool ImageHandler::commit()
+{
+  // broken file
+  if ( !m_complete ) return false;
+
+  // file can't be mapped
+  if ( !m_stamped )
+  {
+    // notify user
+    msg::err( msg::catq("unable to compile file: ", m_filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // write image
+  return writeImage();
+}
+
+
+// -----------------------------------------------------------------------------
+// Internal methods                                             Internal methods
+// -----------------------------------------------------------------------------
+
+// --------
+// addTrack
+// --------
+/*
+ *
+ */
+void ImageHandler::addTrack()
+{
+  // first tag of this track
+  m_tracks.push_back(m_tags.size() / 4);
+
+  // add tags
+  for(unsigned n = 0; n < m_track.size(); n++)
+  {
+    addString( m_track.key(n) );
+    addString( m_track.value(n) );
+  }
+}
+
+// ---------
+// addString
+// ---------
+/*
+ *
+ */
+void ImageHandler::addString(const string& s)
+{
+  // find string in pool
+  unordered_map<string, uint32_t>::const_iterator it = m_offsets.find(s);
+
+  // add string to pool
+  if ( it == m_offsets.end() )
+  {
+    it = m_offsets.insert( make_pair(s, static_cast<uint32_t>(m_pool.size())) ).first;
+    m_pool += s;
+  }
+
+  m_tags.push_back(it->second);
+  m_tags.push_back(s.size());
+}
+
+// ----------
+// writeImage
+// ----------
+/*
+ *
+ */
+bool ImageHandler::writeImage() const
+{
+  // abbreviations
+  const string image = imageName(m_filename);
+  uint32_t     count = m_tags.size() / 4;
+
+  // the tables
+  string tables;
+  tables.reserve( 4 * (m_tracks.size() + 1) + 4 * m_tags.size() );
+
+  // first tag of each track
+  for(size_t t = 0; t < m_tracks.size(); t++)
+  {
+    putU32(tables, m_tracks[t]);
+  }
+
+  putU32(tables, count);
+
+  // offsets and sizes of the tags
+  for(size_t n = 0; n < m_tags.size(); n++)
+  {
+    putU32(tables, m_tags[n]);
+  }
+
+  // get digest of tables and pool
+  MD5 md5;
+  md5.update( tables.data(), tables.size() );
+  md5.update( m_pool.data(), m_pool.size() );
+
+  // header
+  string buffer;
+  buffer.reserve( headerSize + tables.size() );
+
+  buffer.append(imageMagic, sizeof(imageMagic));
+  putU32(buffer, imageVersion);
+  putU32(buffer, m_tracks.size());
+  putU32(buffer, count);
+  putU32(buffer, m_pool.size());
+  putU64(buffer, m_size);
+  putU64(buffer, m_sec);
+  putU32(buffer, m_nsec);
+  putU32(buffer, 0);
+  buffer += md5.digest();
+  buffer += tables;
+
+  // write to a temporary file first (unique per process)
+  string partfile = image + "." + msg::str(static_cast<unsigned>(getpid())) + ".part";
+
+  // open file for writing
+  OutputSink sink;
+
+  // check if file has been opened
+  if ( !sink.open(partfile) )
+  {
+    // notify user
+    msg::err( msg::catq("unable to open file: ", partfile) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // buffered stream
+  ostream out(&sink);
+  out << buffer << m_pool;
+
+  // check state of stream (and write remaining data), replace image
+  if ( !out || !sink.close() || (rename(partfile.c_str(), image.c_str()) != 0) )
+  {
+    // remove temporary file
+    unlink( partfile.c_str() );
+
+    // notify user
+    msg::err( msg::catq("unable to write file: ", image) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // signalize success
+  return true;
+}
@@ -0,0 +1,223 @@
+// -----------------------------------------------------------------------------
+// ImageHandler.h                                                 ImageHandler.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref ImageHandler class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef IMAGEHANDLER_H_INCLUDE_NO1
+#define IMAGEHANDLER_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include "KeyTable.h"
+#include "KVHandler.h"
+#include "TrackRecord.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// ------------
+// ImageHandler
+// ------------
+/**
+ * @brief  This class writes the binary image of each parsed file and
+ *         sends the tracks of a fresh image to another handler instead of
+ *         parsing the file again.
+ *
+ * The image of "name.cd" is "name.cd.bin". It holds the tracks (the tags
+ * each track has when COMPILATIONINDEX arrives) and is mapped into memory
+ * when it is read. All numbers are little endian:
+ *
+ * Bytes           | Content
+ * :-------------- | :------
+ * 8               | magic "RIPGENIM"
+ * 4               | version of the format
+ * 4               | number of tracks (T)
+ * 4               | number of tags (N)
+ * 4               | size of the string pool (P)
+ * 8               | size of the source file
+ * 8               | modification time of the source file (seconds)
+ * 4               | modification time of the source file (nanoseconds)
+ * 4               | reserved (0)
+ * 16              | MD5 digest of the following bytes (tables and pool)
+ * 4 * (T + 1)     | index of the first tag of each track (then N)
+ * 16 * N          | offset and size of the key, offset and size of the value
+ * P               | string pool (each string once, not terminated)
+ *
+ * An image is stale if its source file has another size or modification
+ * time (or if it is broken, damaged or of another version).
+ */
+class ImageHandler : public KVHandler
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // ------------
+  // ImageHandler
+  // ------------
+  /**
+   * @brief  The standard-constructor.
+   */
+  ImageHandler();
+
+
+  // ---------------------------------------------------------------------------
+  // Callback handler                                           Callback handler
+  // ---------------------------------------------------------------------------
+
+  // --------------
+  // OnBeginParsing
+  // --------------
+  /**
+   *
+   */
+  virtual void OnBeginParsing(const string& filename);
+
+  // ------------
+  // OnEndParsing
+  // ------------
+  /**
+   *
+   */
+  virtual void OnEndParsing(bool healthy);
+
+  // ------
+  // OnData
+  // ------
+  /**
+   *
+   */
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // ------
+  // replay
+  // ------
+  /**
+   * @brief  This method sends the tracks of the image of the given file
+   *         to the given handler (like parsing the file would do).
+   *
+   * @param filename  holds the name of the source file.
+   * @param handler   holds the handler that receives the tracks.
+   *
+   * @return  false if there is no fresh image; nothing has been sent in
+   *          this case
+   */
+  bool replay(const string& filename, KVHandler* handler);
+
+  // ------
+  // commit
+  // ------
+  /**
+   * @brief  This method writes the image of the file parsed last.
+   *
+   * The caller has to make sure the whole process chain is healthy (the
+   * handlers in front of this one may fail without telling it).
+   *
+   * @return  false if the file is broken (resp. the image can't be
+   *          written)
+   */
+  bool commit();
+
+
+protected:
+
+  // ---------------------------------------------------------------------------
+  // Internal methods                                           Internal methods
+  // ---------------------------------------------------------------------------
+
+  // --------
+  // addTrack
+  // --------
+  /**
+   * @brief  This method adds the buffered track to the image.
+   */
+  void addTrack();
+
+  // ---------
+  // addString
+  // ---------
+  /**
+   * @brief  This method adds offset and size of the given string (the
+   *         string is added to the pool once).
+   */
+  void addString(const string& s);
+
+  // ----------
+  // writeImage
+  // ----------
+  /**
+   * @brief  This method writes the image of the current file.
+   *
+   * @return  false if the image can't be written
+   */
+  bool writeImage() const;
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the file that is currently parsed
+  string m_filename;
+
+  /// the state of the current file (false: no image is written)
+  bool m_stamped;
+
+  /// the current file has been parsed without errors
+  bool m_complete;
+
+  /// the size and modification time of the current file
+  uint64_t m_size;
+  uint64_t m_sec;
+  uint32_t m_nsec;
+
+  /// the tags of the current track
+  TrackRecord m_track;
+
+  /// the index of the first tag of each track
+  vector<uint32_t> m_tracks;
+
+  /// offset and size of key and value of each tag
+  vector<uint32_t> m_tags;
+
+  /// the string pool
+  string m_pool;
+
+  /// the offsets of the strings in the pool
+  unordered_map<string, uint32_t> m_offsets;
+
+  /// the keys of the replayed tracks
+  KeyTable m_keys;
+
+};
+
+#endif  /* #ifndef IMAGEHANDLER_H_INCLUDE_NO1 */
@@ -0,0 +1,276 @@
+// -----------------------------------------------------------------------------
+// ImportHandler.cpp                                           ImportHandler.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref ImportHandler class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <map>
+#include <cerrno>
+#include <fstream>
+#include <sys/stat.h>
+#include "message.h"
+#include "keyinfo.h"
+#include "translit.h"
+#include "ImportHandler.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------------------------------------------------------------------------
+// Helper functions                                             Helper functions
+// -----------------------------------------------------------------------------
+
+/// the keys whose values are collected
+static const keyinfo::KEYID importKeys[] =
+{
+  keyinfo::COMPOSER,
+  keyinfo::ARRANGER,
+  keyinfo::LYRICIST,
+  keyinfo::CONDUCTOR,
+  keyinfo::ENSEMBLE,
+  keyinfo::PERFORMER,
+  keyinfo::OPUS,
+  keyinfo::ARTIST
+};
+
+/// the number of keys whose values are collected
+static const unsigned importKeyCount = sizeof(importKeys) / sizeof(importKeys[0]);
+
+// ----
+// trim
+// ----
+/*
+ * the given part of s without surrounding white space
+ */
+static string trim(const string& s, string::size_type first, string::size_type last)
+{
+  // skip leading white space
+  while ( (first < last) && ((s[first] == ' ') || (s[first] == '\t')) ) first++;
+
+  // skip trailing white space
+  while ( (last > first) && ((s[last - 1] == ' ') || (s[last - 1] == '\t')) ) last--;
+
+  return s.substr(first, last - first);
+}
+
+// -------------
+// makeDirectory
+// -------------
+/*
+ *
+ */
+static bool makeDirectory(const string& dirname)
+{
+  // create directory (if missing)
+  if ( (mkdir(dirname.c_str(), 0777) != 0) && (errno != EEXIST) )
+  {
+    // notify user
+    msg::err( msg::catq("unable to create directory: ", dirname) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // signalize success
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// -------------
+// ImportHandler
+// -------------
+/*
+ *
+ */
+ImportHandler::ImportHandler()
+: m_values(importKeyCount)
+{
+  // initialization
+}
+
+
+// -----------------------------------------------------------------------------
+// Callback handler                                             Callback handler
+// -----------------------------------------------------------------------------
+
+// --------------
+// OnBeginParsing
+// --------------
+/*
+ *
+ */
+void ImportHandler::OnBeginParsing(const string& filename)
+{
+  // update healthy flag
+  setHealthy();
+
+  // empty buffers
+  m_track.clear();
+}
+
+// ------------
+// OnEndParsing
+// ------------
+/*
+ *
+ */
+void ImportHandler::OnEndParsing(bool healthy)
+{
+  // empty buffers
+  m_track.clear();
+}
+
+// ------
+// OnData
+// ------
+/*
+ *
+ */
+void ImportHandler::OnData(unsigned keyID, const string& key, const string& value)
+{
+  // don't run in bad state
+  if ( !healthy() ) return;
+
+  // buffer tag
+  m_track.add(keyID, key, value);
+
+  // trigger found
+  if (keyID == keyinfo::COMPILATIONINDEX)
+  {
+    // collect values
+    addValues();
+
+    // empty buffers
+    m_track.clear();
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// -----
+// write
+// -----
+/*
+ * values that share a filename are written in order (the last one wins)
+ */
+bool ImportHandler::write(const string& directory) const
+{
+  // the content of each file
+  map<string, string> files;
+
+  // the directories of the keys
+  vector<string> dirnames;
+
+  for(unsigned n = 0; n < importKeyCount; n++)
+  {
+    // abbreviation
+    const string& key = keyinfo::name(importKeys[n]);
+
+    // get name of the directory
+    string dirname;
+    translit::filename(key, dirname);
+    dirname = directory + "/" + dirname;
+
+    for(set<string>::const_iterator it = m_values[n].begin(); it != m_values[n].end(); ++it)
+    {
+      // get name of the file
+      string filename;
+      if ( !translit::filename(*it, filename) || filename.empty() )
+      {
+        // notify user
+        msg::wrn( msg::catq("skipping invalid pair: ", key + "=" + *it) );
+
+        // next value
+        continue;
+      }
+
+      // add directory (once)
+      if ( dirnames.empty() || (dirnames.back() != dirname) ) dirnames.push_back(dirname);
+
+      // set content
+      files[dirname + "/" + filename] = key + "=" + *it + "\n";
+    }
+  }
+
+  // create directories
+  for(unsigned i = 0; i < dirnames.size(); i++)
+  {
+    if ( !makeDirectory(dirnames[i]) ) return false;
+  }
+
+  // create files
+  for(map<string, string>::const_iterator it = files.begin(); it != files.end(); ++it)
+  {
+    ofstream out(it->first.c_str(), ios::out | ios::binary | ios::trunc);
+    out << it->second;
+    out.close();
+
+    // check state
+    if ( !out )
+    {
+      // notify user
+      msg::err( msg::catq("unable to write file: ", it->first) );
+
+      // signalize trouble
+      return false;
+    }
+  }
+
+  // signalize success
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Internal methods                                             Internal methods
+// -----------------------------------------------------------------------------
+
+// ---------
+// addValues
+// ---------
+/*
+ * "A; B ;C" are the values "A", "B" and "C"
+ */
+void ImportHandler::addValues()
+{
+  for(unsigned n = 0; n < importKeyCount; n++)
+  {
+    // abbreviation
+    const string& value = m_track.get(importKeys[n]);
+
+    // split value at semicolons
+    string::size_type first = 0;
+    while ( first <= value.size() )
+    {
+      // get end of this part
+      string::size_type last = value.find(';', first);
+      if (last == string::npos) last = value.size();
+
+      // add non-empty part
+      string part = trim(value, first, last);
+      if ( !part.empty() ) m_values[n].insert(part);
+
+      // next part
+      first = last + 1;
+    }
+  }
+}
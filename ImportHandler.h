@@ -0,0 +1,140 @@
+// -----------------------------------------------------------------------------
+// ImportHandler.h                                               ImportHandler.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref ImportHandler class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef IMPORTHANDLER_H_INCLUDE_NO1
+#define IMPORTHANDLER_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <set>
+#include <vector>
+#include <string>
+#include "KVHandler.h"
+#include "TrackRecord.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -------------
+// ImportHandler
+// -------------
+/**
+ * @brief  This class collects the different values of the persons (and
+ *         opus) of all tracks and writes one importable file per value.
+ *
+ * Values are split at semicolons. Each value "V" of key "KEY" is written
+ * as line "KEY=V" to the file "key/v" (both names transliterated like
+ * filenames), so it can be read by vim's :r command.
+ */
+class ImportHandler : public KVHandler
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // -------------
+  // ImportHandler
+  // -------------
+  /**
+   * @brief  The standard-constructor.
+   */
+  ImportHandler();
+
+
+  // ---------------------------------------------------------------------------
+  // Callback handler                                           Callback handler
+  // ---------------------------------------------------------------------------
+
+  // --------------
+  // OnBeginParsing
+  // --------------
+  /**
+   *
+   */
+  virtual void OnBeginParsing(const string& filename);
+
+  // ------------
+  // OnEndParsing
+  // ------------
+  /**
+   *
+   */
+  virtual void OnEndParsing(bool healthy);
+
+  // ------
+  // OnData
+  // ------
+  /**
+   *
+   */
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // -----
+  // write
+  // -----
+  /**
+   * @brief  This method writes the files of all collected values.
+   *
+   * @param directory  holds the directory that receives the directories
+   *                   of the keys.
+   *
+   * @return  false if a directory or file can't be written
+   */
+  bool write(const string& directory) const;
+
+
+protected:
+
+  // ---------------------------------------------------------------------------
+  // Internal methods                                           Internal methods
+  // ---------------------------------------------------------------------------
+
+  // ---------
+  // addValues
+  // ---------
+  /**
+   * @brief  This method adds the values of the buffered track.
+   */
+  void addValues();
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the tags of the current track
+  TrackRecord m_track;
+
+  /// the different values of each key (see the keys in ImportHandler.cpp)
+  vector< set<string> > m_values;
+
+};
+
+#endif  /* #ifndef IMPORTHANDLER_H_INCLUDE_NO1 */
@@ -0,0 +1,656 @@
+// -----------------------------------------------------------------------------
+// JobRunner.cpp                                                   JobRunner.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref JobRunner class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <spawn.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "keyinfo.h"
+#include "message.h"
+#include "FlacFile.h"
+#include "JobRunner.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------------------------------------------------------------------------
+// Constants                                                           Constants
+// -----------------------------------------------------------------------------
+
+/// the options of flac that affect the audio data
+static const char* const encoderOptions[] =
+{
+  "--verify",
+  "--compression-level-8"
+};
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// ---------
+// JobRunner
+// ---------
+/*
+ *
+ */
+JobRunner::JobRunner(unsigned slots)
+: m_slots(slots),
+  m_progress( isatty(STDERR_FILENO) ),
+  m_total(0),
+  m_done(0),
+  m_failed(0),
+  m_running(0),
+  m_journal(0),
+  m_cache(0),
+  m_encoder(0)
+{
+  // one track per processor
+  if (m_slots == 0)
+  {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    m_slots = (count > 0) ? static_cast<unsigned>(count) : 1;
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// ---
+// run
+// ---
+/*
+ *
+ */
+bool JobRunner::run(const vector<TrackJob>& jobs)
+{
+  // reset counters
+  m_total   = jobs.size();
+  m_done    = 0;
+  m_failed  = 0;
+  m_running = 0;
+
+  // one task per slot (pid -1 marks a free slot)
+  vector<Task> tasks(m_slots);
+  for(unsigned i = 0; i < tasks.size(); i++)
+  {
+    tasks[i].pid = -1;
+  }
+
+  // the next job to start
+  size_t next = 0;
+
+  // run all jobs
+  while ( (next < jobs.size()) || (m_running > 0) )
+  {
+    // fill free slots
+    for(unsigned i = 0; (i < tasks.size()) && (next < jobs.size()); i++)
+    {
+      if (tasks[i].pid == -1) start(jobs[next++], tasks[i]);
+    }
+
+    // update progress line
+    showState();
+
+    // all remaining jobs were skipped
+    if (m_running == 0) continue;
+
+    // wait for the next command to finish
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, 0);
+
+    // interrupted by a signal
+    if (pid == -1)
+    {
+      if (errno == EINTR) continue;
+
+      // notify user
+      hideState();
+      msg::err( msg::cat("unable to wait for encoder: ", strerror(errno)) );
+
+      // signalize trouble
+      return false;
+    }
+
+    // find related task
+    for(unsigned i = 0; i < tasks.size(); i++)
+    {
+      // task found
+      if (tasks[i].pid == pid)
+      {
+        // slot is free again
+        tasks[i].pid = -1;
+        m_running--;
+
+        // command succeeded
+        if ( WIFEXITED(status) && (WEXITSTATUS(status) == 0) )
+        {
+          // run next command
+          tasks[i].step++;
+          proceed(tasks[i]);
+        }
+
+        // command failed
+        else
+        {
+          // get name of the command
+          const string& name = tasks[i].commands[tasks[i].step][0];
+
+          // get reason
+          string reason = WIFEXITED(status)
+                        ? msg::ins(name + " exited with status ~", msg::str(WEXITSTATUS(status)))
+                        : msg::ins(name + " was killed by signal ~", msg::str(WTERMSIG(status)));
+
+          // notify user
+          fail(tasks[i], reason);
+        }
+
+        // update progress line
+        showState();
+
+        // stop search
+        break;
+      }
+    }
+  }
+
+  // remove progress line
+  hideState();
+
+  // check failed jobs
+  if (m_failed > 0)
+  {
+    // notify user
+    msg::err( msg::cat("number of failed tracks: ", msg::str(static_cast<unsigned>(m_failed))) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // signalize success
+  return true;
+}
+
+// ----------
+// setJournal
+// ----------
+/*
+ *
+ */
+void JobRunner::setJournal(Journal* journal)
+{
+  m_journal = journal;
+}
+
+// --------
+// setCache
+// --------
+/*
+ *
+ */
+void JobRunner::setCache(EncodeCache* cache)
+{
+  m_cache = cache;
+}
+
+// ----------
+// setEncoder
+// ----------
+/*
+ *
+ */
+void JobRunner::setEncoder(FlacEncoder* encoder)
+{
+  m_encoder = encoder;
+}
+
+
+// -----------------------------------------------------------------------------
+// Internal methods                                             Internal methods
+// -----------------------------------------------------------------------------
+
+// -----
+// start
+// -----
+/*
+ *
+ */
+void JobRunner::start(const TrackJob& job, Task& task)
+{
+  // set up task
+  task.job     = &job;
+  task.step    = 0;
+  task.pid     = -1;
+  task.renamed = job.singlePass || job.filename.empty();
+  task.picture = false;
+  task.tagged  = job.singlePass || job.keys.empty();
+  task.commands.clear();
+
+  // check wav file
+  struct stat info;
+  if ( (stat(job.infile.c_str(), &info) != 0) || (info.st_size == 0) )
+  {
+    // notify user
+    hideState();
+    msg::wrn( msg::cat("skipping missing (or empty) wav file: ", job.infile) );
+
+    // remove (touched resp. truncated) flac file
+    if ( !job.filename.empty() ) remove( job.filename.c_str() );
+
+    // job is done
+    m_done++;
+
+    // signalize skipped job
+    return;
+  }
+
+  // job finished by an earlier run
+  if ( m_journal && m_journal->done(job) )
+  {
+    // notify user
+    hideState();
+    msg::nfo( msg::cat("already done: ", job.infile) );
+
+    // job is done
+    m_done++;
+
+    // signalize skipped job
+    return;
+  }
+
+  // copy (resp. fill) the encode cache
+  if ( m_cache && addCachedCommands(job, task) )
+  {
+    // run first command
+    proceed(task);
+
+    // signalize started job
+    return;
+  }
+
+  // encode track with the built-in encoder
+  if (m_encoder)
+  {
+    encodeTrack(job, task);
+
+    // signalize finished job
+    return;
+  }
+
+  // create flac command (without progress output)
+  vector<string> flac;
+  flac.push_back("flac");
+  flac.push_back("--force");
+  flac.push_back("--silent");
+  flac.insert(flac.end(), begin(encoderOptions), end(encoderOptions));
+  if ( !job.image.empty() )
+  {
+    flac.push_back("--picture=3||||" + job.image);
+  }
+  if (job.singlePass)
+  {
+    for(unsigned n = 0; n < job.keys.size(); n++)
+    {
+      flac.push_back("--tag=" + keyinfo::name(job.keys[n]) + "=" + job.values[n]);
+    }
+  }
+  flac.push_back("--output-name=" + job.target);
+  flac.push_back(job.infile);
+  task.commands.push_back(flac);
+
+  // show progress
+  hideState();
+  msg::nfo( msg::cat("converting ", job.infile) );
+
+  // run first command
+  proceed(task);
+}
+
+// -----------------
+// addCachedCommands
+// -----------------
+/*
+ *
+ */
+bool JobRunner::addCachedCommands(const TrackJob& job, Task& task)
+{
+  // the options of the encoder
+  string settings;
+  for(const char* option : encoderOptions)
+  {
+    settings += settings.empty() ? option : string(" ") + option;
+  }
+
+  // get name of the cached flac file
+  string cachefile;
+  if ( !m_cache->locate(job.infile, settings, cachefile) ) return false;
+
+  // the audio data is already cached
+  struct stat info;
+  bool cached = (stat(cachefile.c_str(), &info) == 0);
+
+  // encode wav file (without image and comments)
+  if ( !cached )
+  {
+    // the file written by flac (unique per process and track)
+    string partfile = cachefile + "." + msg::str(static_cast<unsigned>(getpid()))
+                                + "." + job.index + ".part";
+
+    // create flac command (without progress output)
+    vector<string> flac;
+    flac.push_back("flac");
+    flac.push_back("--force");
+    flac.push_back("--silent");
+    flac.insert(flac.end(), begin(encoderOptions), end(encoderOptions));
+    flac.push_back("--output-name=" + partfile);
+    flac.push_back(job.infile);
+    task.commands.push_back(flac);
+
+    // add complete file to the cache
+    vector<string> mv;
+    mv.push_back("mv");
+    mv.push_back("-f");
+    mv.push_back(partfile);
+    mv.push_back(cachefile);
+    task.commands.push_back(mv);
+  }
+
+  // copy cached audio data
+  vector<string> cp;
+  cp.push_back("cp");
+  cp.push_back("-f");
+  cp.push_back(cachefile);
+  cp.push_back(job.target);
+  task.commands.push_back(cp);
+
+  // the copy gets image and comments
+  task.picture = true;
+  task.tagged = job.image.empty() && job.keys.empty();
+
+  // show progress
+  hideState();
+  msg::nfo( msg::cat(cached ? "reusing cached audio of " : "converting ", job.infile) );
+
+  // signalize success
+  return true;
+}
+
+// -----------
+// encodeTrack
+// -----------
+/*
+ * the padding leaves room for image and comments
+ */
+void JobRunner::encodeTrack(const TrackJob& job, Task& task)
+{
+  // get size of image and comments
+  unsigned padding = 8192;
+
+  struct stat info;
+  if ( !job.image.empty() && (stat(job.image.c_str(), &info) == 0) )
+  {
+    padding += static_cast<unsigned>(info.st_size) + job.image.size() + 64;
+  }
+
+  for(unsigned n = 0; n < job.keys.size(); n++)
+  {
+    padding += 4 + keyinfo::name(job.keys[n]).size() + 1 + job.values[n].size();
+  }
+
+  // show progress
+  hideState();
+  msg::nfo( msg::cat("converting ", job.infile) );
+
+  // encode wav file
+  if ( !m_encoder->encode(job.infile, job.target, padding) )
+  {
+    // notify user
+    fail(task, msg::catq("unable to encode file: ", job.infile));
+
+    // signalize trouble
+    return;
+  }
+
+  // the flac file gets image and comments
+  task.picture = true;
+  task.tagged  = job.image.empty() && job.keys.empty();
+
+  // tag and rename file
+  proceed(task);
+}
+
+// -------
+// proceed
+// -------
+/*
+ *
+ */
+void JobRunner::proceed(Task& task)
+{
+  // all commands done
+  while ( task.step == task.commands.size() )
+  {
+    // set comments (resp. image)
+    if ( !task.tagged )
+    {
+      // tag file only once
+      task.tagged = true;
+
+      if ( !tagFile(task) )
+      {
+        // notify user
+        fail(task, msg::catq("unable to tag file: ", task.job->target));
+
+        // signalize trouble
+        return;
+      }
+
+      // next step
+      continue;
+    }
+
+    // job finished
+    if (task.renamed)
+    {
+      // job is done
+      m_done++;
+
+      // notify user
+      hideState();
+      msg::nfo( msg::cat("finished: ", task.job->infile) );
+
+      // record finished job
+      if ( m_journal && !m_journal->add(*task.job) )
+      {
+        // notify user
+        msg::wrn( msg::catq("unable to record finished track: ", task.job->destination) );
+      }
+
+      // signalize success
+      return;
+    }
+
+    // rename file
+    task.renamed = true;
+    if ( rename(task.job->outfile.c_str(), task.job->filename.c_str()) != 0 )
+    {
+      // different file systems
+      if (errno == EXDEV)
+      {
+        // copy and remove the file
+        vector<string> mv;
+        mv.push_back("mv");
+        mv.push_back("-f");
+        mv.push_back(task.job->outfile);
+        mv.push_back(task.job->filename);
+        task.commands.push_back(mv);
+      }
+
+      else
+      {
+        // notify user
+        fail(task, msg::catq("unable to rename file: ", task.job->filename));
+
+        // signalize trouble
+        return;
+      }
+    }
+  }
+
+  // run next command
+  task.pid = spawn(task.commands[task.step]);
+
+  // command not started
+  if (task.pid == -1)
+  {
+    // notify user
+    fail(task, msg::catq("unable to run ", task.commands[task.step][0]));
+
+    // signalize trouble
+    return;
+  }
+
+  // command started
+  m_running++;
+}
+
+// -------
+// tagFile
+// -------
+/*
+ *
+ */
+bool JobRunner::tagFile(const Task& task) const
+{
+  // abbreviation
+  const TrackJob& job = *task.job;
+
+  // messages follow
+  hideState();
+
+  // read metadata
+  FlacFile file;
+  if ( !file.load(job.target) ) return false;
+
+  // the image (unless flac has added it)
+  if ( task.picture && !job.image.empty() && !file.setPicture(3, job.image) ) return false;
+
+  // comments
+  for(unsigned n = 0; n < job.keys.size(); n++)
+  {
+    file.addTag(keyinfo::name(job.keys[n]), job.values[n]);
+  }
+
+  // write metadata
+  return file.save();
+}
+
+// ----
+// fail
+// ----
+/*
+ *
+ */
+void JobRunner::fail(Task& task, const string& reason)
+{
+  // job is done
+  m_done++;
+  m_failed++;
+
+  // no process is running
+  task.pid = -1;
+
+  // remove (truncated resp. partial) flac file; it would look up to date
+  remove( task.job->destination.c_str() );
+
+  // notify user
+  hideState();
+  msg::err( msg::cat("failed: ", task.job->infile) + " (" + reason + ")" );
+}
+
+// -----
+// spawn
+// -----
+/*
+ *
+ */
+pid_t JobRunner::spawn(const vector<string>& command) const
+{
+  // create argument list
+  vector<char*> argv;
+  for(unsigned i = 0; i < command.size(); i++)
+  {
+    argv.push_back( const_cast<char*>(command[i].c_str()) );
+  }
+  argv.push_back(0);
+
+  // the encoders don't read from stdin
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+
+  // search PATH and run command
+  pid_t pid = -1;
+  int result = posix_spawnp(&pid, argv[0], &actions, 0, argv.data(), environ);
+
+  // free resources
+  posix_spawn_file_actions_destroy(&actions);
+
+  // return process ID
+  return (result == 0) ? pid : -1;
+}
+
+// ---------
+// showState
+// ---------
+/*
+ *
+ */
+void JobRunner::showState() const
+{
+  // no terminal
+  if ( !m_progress ) return;
+
+  // print progress line
+  cerr << "\r\033[K" << "[" << m_done << "/" << m_total << "] "
+       << m_running << " running, " << m_failed << " failed" << flush;
+}
+
+// ---------
+// hideState
+// ---------
+/*
+ *
+ */
+void JobRunner::hideState() const
+{
+  // no terminal
+  if ( !m_progress ) return;
+
+  // clear progress line
+  cerr << "\r\033[K" << flush;
+}
+
@@ -0,0 +1,277 @@
+// -----------------------------------------------------------------------------
+// JobRunner.h                                                       JobRunner.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref JobRunner class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef JOBRUNNER_H_INCLUDE_NO1
+#define JOBRUNNER_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include <sys/types.h>
+#include "TrackJob.h"
+#include "Journal.h"
+#include "EncodeCache.h"
+#include "FlacEncoder.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// ---------
+// JobRunner
+// ---------
+/**
+ * @brief  This class encodes tracks by running flac directly (without a
+ *         shell) and tags them itself.
+ *
+ * Up to a given number of tracks are encoded at once; the commands of
+ * one track run one after another. The outcome of each track is reported
+ * when it is done and a progress line is kept at the bottom of the
+ * terminal.
+ */
+class JobRunner
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // ---------
+  // JobRunner
+  // ---------
+  /**
+   * @brief  The standard-constructor.
+   *
+   * @param slots  holds the number of tracks encoded at once
+   *               (0 means one track per processor).
+   */
+  JobRunner(unsigned slots = 0);
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // ---
+  // run
+  // ---
+  /**
+   * @brief  This method runs the given jobs.
+   *
+   * @return  false if at least one job failed
+   */
+  bool run(const vector<TrackJob>& jobs);
+
+  // ----------
+  // setJournal
+  // ----------
+  /**
+   * @brief  This method sets the journal of finished tracks.
+   *
+   * Jobs already done according to the journal are skipped, finished
+   * jobs are added to the journal.
+   */
+  void setJournal(Journal* journal);
+
+  // --------
+  // setCache
+  // --------
+  /**
+   * @brief  This method sets the cache of encoded audio data.
+   *
+   * Tracks whose audio is cached are copied from the cache and tagged;
+   * other tracks are encoded into the cache first.
+   */
+  void setCache(EncodeCache* cache);
+
+  // ----------
+  // setEncoder
+  // ----------
+  /**
+   * @brief  This method sets the built-in encoder.
+   *
+   * Tracks are encoded one after another (each by several threads) and
+   * tagged without running flac.
+   */
+  void setEncoder(FlacEncoder* encoder);
+
+
+protected:
+
+  // ---------------------------------------------------------------------------
+  // Types                                                                 Types
+  // ---------------------------------------------------------------------------
+
+  // ----
+  // Task
+  // ----
+  /**
+   * @brief  The state of a running job.
+   */
+  struct Task
+  {
+    /// the job to run
+    const TrackJob* job;
+
+    /// the commands to run (one after another)
+    vector< vector<string> > commands;
+
+    /// the number of the current command
+    unsigned step;
+
+    /// the process running the current command
+    pid_t pid;
+
+    /// the flac file has been moved to its final name
+    bool renamed;
+
+    /// the image has to be added to the flac file (flac didn't)
+    bool picture;
+
+    /// the flac file has got its comments (resp. image)
+    bool tagged;
+  };
+
+
+  // ---------------------------------------------------------------------------
+  // Internal methods                                           Internal methods
+  // ---------------------------------------------------------------------------
+
+  // -----
+  // start
+  // -----
+  /**
+   * @brief  This method checks the wav file of the given job and starts
+   *         its first command (or skips the job).
+   */
+  void start(const TrackJob& job, Task& task);
+
+  // -----------------
+  // addCachedCommands
+  // -----------------
+  /**
+   * @brief  This method adds the commands that copy the cached audio of
+   *         the given job (after encoding it, if necessary) and tag it.
+   *
+   * @return  false if the wav file can't be read
+   */
+  bool addCachedCommands(const TrackJob& job, Task& task);
+
+  // -----------
+  // encodeTrack
+  // -----------
+  /**
+   * @brief  This method encodes the given job with the built-in encoder
+   *         and finishes it.
+   */
+  void encodeTrack(const TrackJob& job, Task& task);
+
+  // -------
+  // proceed
+  // -------
+  /**
+   * @brief  This method starts the current command of the given task
+   *         or finishes the task if all commands are done.
+   */
+  void proceed(Task& task);
+
+  // -------
+  // tagFile
+  // -------
+  /**
+   * @brief  This method sets the comments (and the image, unless flac
+   *         has added it) of the flac file of the given task.
+   */
+  bool tagFile(const Task& task) const;
+
+  // ----
+  // fail
+  // ----
+  /**
+   * @brief  This method reports the failure of the given task.
+   */
+  void fail(Task& task, const string& reason);
+
+  // -----
+  // spawn
+  // -----
+  /**
+   * @brief  This method starts the given command.
+   *
+   * @return  the ID of the new process (-1 on failure)
+   */
+  pid_t spawn(const vector<string>& command) const;
+
+  // ---------
+  // showState
+  // ---------
+  /**
+   * @brief  This method updates the progress line.
+   */
+  void showState() const;
+
+  // ---------
+  // hideState
+  // ---------
+  /**
+   * @brief  This method removes the progress line (before messages).
+   */
+  void hideState() const;
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the number of tracks encoded at once
+  unsigned m_slots;
+
+  /// show a progress line (stderr is a terminal)
+  bool m_progress;
+
+  /// the number of jobs
+  size_t m_total;
+
+  /// the number of jobs done (finished, skipped or failed)
+  size_t m_done;
+
+  /// the number of failed jobs
+  size_t m_failed;
+
+  /// the number of running jobs
+  size_t m_running;
+
+  /// the journal of finished tracks (0 if none)
+  Journal* m_journal;
+
+  /// the cache of encoded audio data (0 if none)
+  EncodeCache* m_cache;
+
+  /// the built-in encoder (0 means flac)
+  FlacEncoder* m_encoder;
+
+};
+
+#endif  /* #ifndef JOBRUNNER_H_INCLUDE_NO1 */
+
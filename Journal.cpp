@@ -0,0 +1,211 @@
+// -----------------------------------------------------------------------------
+// Journal.cpp                                                       Journal.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref Journal class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "Journal.h"
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// -------
+// Journal
+// -------
+/*
+ *
+ */
+Journal::Journal()
+: m_fd(-1)
+{
+  // nothing
+}
+
+// --------
+// ~Journal
+// --------
+/*
+ *
+ */
+Journal::~Journal()
+{
+  if (m_fd != -1)
+  {
+    ::close(m_fd);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// ----
+// open
+// ----
+/*
+ *
+ */
+bool Journal::open(const string& filename)
+{
+  // forget previous journal
+  if (m_fd != -1) ::close(m_fd);
+  m_entries.clear();
+
+  // read existing lines
+  ifstream file(filename.c_str());
+
+  // one line
+  string line;
+
+  while ( getline(file, line) )
+  {
+    // digest, wav size, wav mtime, flac size, flac file
+    string::size_type pos = 0;
+    for(unsigned field = 0; (field < 4) && (pos != string::npos); field++)
+    {
+      pos = line.find(' ', pos);
+      if (pos != string::npos) pos++;
+    }
+
+    // broken line
+    if ( (pos == string::npos) || (pos == line.size()) ) continue;
+
+    // the last line of a flac file wins
+    m_entries[ line.substr(pos) ] = line.substr(0, pos - 1);
+  }
+
+  // open for appending
+  m_fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0666);
+
+  // signalize success
+  return (m_fd != -1);
+}
+
+// ---
+// add
+// ---
+/*
+ *
+ */
+bool Journal::add(const TrackJob& job)
+{
+  // journal not opened
+  if (m_fd == -1) return false;
+
+  // names with line breaks can't be recorded
+  if (job.destination.find('\n') != string::npos) return false;
+
+  // get current state
+  string line;
+  if ( !stamp(job, line) ) return false;
+
+  // remember entry
+  m_entries[job.destination] = line;
+
+  // append the whole line at once
+  line += " " + job.destination + "\n";
+
+  // write line
+  const char* data = line.data();
+  size_t      size = line.size();
+
+  while (size > 0)
+  {
+    ssize_t written = ::write(m_fd, data, size);
+
+    if (written < 0)
+    {
+      // interrupted by a signal
+      if (errno == EINTR) continue;
+
+      // signalize trouble
+      return false;
+    }
+
+    data += written;
+    size -= written;
+  }
+
+  // signalize success
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Status information                                         Status information
+// -----------------------------------------------------------------------------
+
+// ----
+// done
+// ----
+/*
+ *
+ */
+bool Journal::done(const TrackJob& job) const
+{
+  // search entry
+  map<string, string>::const_iterator it = m_entries.find(job.destination);
+
+  // flac file never finished
+  if ( it == m_entries.end() ) return false;
+
+  // get current state
+  string line;
+  if ( !stamp(job, line) ) return false;
+
+  // compare with the recorded state
+  return (line == it->second);
+}
+
+
+// -----------------------------------------------------------------------------
+// Internal methods                                             Internal methods
+// -----------------------------------------------------------------------------
+
+// -----
+// stamp
+// -----
+/*
+ *
+ */
+bool Journal::stamp(const TrackJob& job, string& line) const
+{
+  // the state of the wav file and the flac file
+  struct stat wav;
+  struct stat flac;
+
+  // files are missing
+  if (stat(job.infile.c_str(),      &wav)  != 0) return false;
+  if (stat(job.destination.c_str(), &flac) != 0) return false;
+
+  // create line
+  stringstream strstr;
+  strstr << job.digest() << " "
+         << wav.st_size << " "
+         << wav.st_mtim.tv_sec << "." << wav.st_mtim.tv_nsec << " "
+         << flac.st_size;
+
+  // get line
+  line = strstr.str();
+
+  // signalize success
+  return true;
+}
+
@@ -0,0 +1,157 @@
+// -----------------------------------------------------------------------------
+// Journal.h                                                           Journal.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref Journal class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef JOURNAL_H_INCLUDE_NO1
+#define JOURNAL_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <map>
+#include <string>
+#include "TrackJob.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -------
+// Journal
+// -------
+/**
+ * @brief  An append-only list of finished tracks.
+ *
+ * Each line describes one finished track:
+ *
+ *     <digest> <wav size> <wav mtime> <flac size> <flac file>
+ *
+ * A track is done if its last line matches the digest of its job, the
+ * current size and modification time of its wav file and the size of
+ * its flac file. Broken lines (e.g. of an interrupted run) are ignored.
+ */
+class Journal
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // -------
+  // Journal
+  // -------
+  /**
+   * @brief  The standard-constructor.
+   */
+  Journal();
+
+  // --------
+  // ~Journal
+  // --------
+  /**
+   * @brief  The destructor closes the journal.
+   */
+  ~Journal();
+
+  // -------
+  // Journal
+  // -------
+  /**
+   * @brief  Journals can't be copied.
+   */
+  Journal(const Journal&) = delete;
+
+  // ---------
+  // operator=
+  // ---------
+  /**
+   * @brief  Journals can't be copied.
+   */
+  Journal& operator=(const Journal&) = delete;
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // ----
+  // open
+  // ----
+  /**
+   * @brief  This method reads the given journal (if it exists) and opens
+   *         it for appending.
+   */
+  bool open(const string& filename);
+
+  // ---
+  // add
+  // ---
+  /**
+   * @brief  This method records the given (finished) job.
+   */
+  bool add(const TrackJob& job);
+
+
+  // ---------------------------------------------------------------------------
+  // Status information                                       Status information
+  // ---------------------------------------------------------------------------
+
+  // ----
+  // done
+  // ----
+  /**
+   * @brief  This method checks if the given job is already done.
+   */
+  bool done(const TrackJob& job) const;
+
+
+protected:
+
+  // ---------------------------------------------------------------------------
+  // Internal methods                                           Internal methods
+  // ---------------------------------------------------------------------------
+
+  // -----
+  // stamp
+  // -----
+  /**
+   * @brief  This method creates the line of the given job from the
+   *         current state of its files (without flac file and newline).
+   *
+   * @return  false if a file is missing
+   */
+  bool stamp(const TrackJob& job, string& line) const;
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the file descriptor of the journal (-1 if closed)
+  int m_fd;
+
+  /// the last line of each flac file (without flac file)
+  map<string, string> m_entries;
+
+};
+
+#endif  /* #ifndef JOURNAL_H_INCLUDE_NO1 */
+
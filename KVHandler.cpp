@@ -29,6 +29,9 @@ KVHandler::KVHandler()
 {
   // start in healthy state
   m_healthy = true;
+
+  // nobody to notify
+  m_abort = 0;
 }
 
 // ----------
@@ -75,12 +78,28 @@ void KVHandler::OnEndParsing(bool healthy)
 /*
  *
  */
-void KVHandler::OnData(const string& key, const string& value)
+void KVHandler::OnData(unsigned keyID, const string& key, const string& value)
 {
   // nothing
 }
 
 
+// -----------------------------------------------------------------------------
+// Initialization                                                 Initialization
+// -----------------------------------------------------------------------------
+
+// --------------
+// setAbortSignal
+// --------------
+/*
+ *
+ */
+void KVHandler::setAbortSignal(bool* signal)
+{
+  m_abort = signal;
+}
+
+
 // -----------------------------------------------------------------------------
 // Internal methods                                             Internal methods
 // -----------------------------------------------------------------------------
@@ -94,6 +113,23 @@ void KVHandler::OnData(const string& key, const string& value)
 void KVHandler::setHealthy(bool healthy)
 {
   m_healthy = healthy;
+
+  // raise flag
+  if ( !healthy && (m_abort != 0) )
+  {
+    *m_abort = true;
+  }
+}
+
+// -----------
+// abortSignal
+// -----------
+/*
+ *
+ */
+bool* KVHandler::abortSignal() const
+{
+  return m_abort;
 }
 
 
@@ -84,9 +84,29 @@ public:
   // OnData
   // ------
   /**
+   * @param keyID  holds the ID of the key (see KeyTable::intern()).
+   * @param key    holds the name of the key; the referenced string stays
+   *               valid until the file has been parsed.
+   * @param value  holds the value.
+   */
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
+
+
+  // ---------------------------------------------------------------------------
+  // Initialization                                               Initialization
+  // ---------------------------------------------------------------------------
+
+  // --------------
+  // setAbortSignal
+  // --------------
+  /**
+   * @brief  This method sets the flag that is raised as soon as the
+   *         handler becomes unhealthy.
    *
+   * The parser passes its own flag, so it doesn't need to poll the
+   * healthy state of the handler while reading.
    */
-  virtual void OnData(const string& key, const string& value);
+  virtual void setAbortSignal(bool* signal);
 
 
   // ---------------------------------------------------------------------------
@@ -116,6 +136,14 @@ protected:
    */
   void setHealthy(bool healthy = true);
 
+  // -----------
+  // abortSignal
+  // -----------
+  /**
+   *
+   */
+  bool* abortSignal() const;
+
 
 private:
 
@@ -126,6 +154,9 @@ private:
   /// the handler's healthy state
   bool m_healthy;
 
+  /// this flag is raised when the handler becomes unhealthy
+  bool* m_abort;
+
 };
 
 #endif  /* #ifndef KVHANDLER_H_INCLUDE_NO1 */
@@ -12,9 +12,14 @@
 // -----------------------------------------------------------------------------
 // Includes                                                             Includes
 // -----------------------------------------------------------------------------
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
 #include <sstream>
-#include <fstream>
-#include <iostream>
 #include "message.h"
 #include "KVHandler.h"
 #include "KVParser.h"
@@ -43,6 +48,9 @@ KVParser::KVParser()
 
   // initialize pointer
   m_handler = 0;
+
+  // lower flag
+  m_abort = false;
 }
 
 
@@ -58,7 +66,19 @@ KVParser::KVParser()
  */
 void KVParser::setHandler(KVHandler* handler)
 {
+  // detach previous handler
+  if (m_handler)
+  {
+    m_handler->setAbortSignal(0);
+  }
+
   m_handler = handler;
+
+  // let handler raise the flag
+  if (m_handler)
+  {
+    m_handler->setAbortSignal(&m_abort);
+  }
 }
 
 
@@ -87,8 +107,14 @@ bool KVParser::parse()
   // send message
   m_handler->OnBeginParsing("");
 
-  // use internal method
-  bool flag = parseStream(cin);
+  // get initial state once
+  m_abort = !(m_handler->healthy());
+
+  // the content of stdin
+  string buffer;
+
+  // read stdin and use internal method
+  bool flag = readStream(0, buffer) && parseBuffer(buffer.data(), buffer.size());
 
   // send message
   m_handler->OnEndParsing(flag);
@@ -121,27 +147,71 @@ bool KVParser::parse(const string& filename)
   // send message
   m_handler->OnBeginParsing(filename);
 
+  // get initial state once
+  m_abort = !(m_handler->healthy());
+
   // try to open file for reading
-  ifstream ifile(filename.c_str());
+  int fd = open(filename.c_str(), O_RDONLY);
+
+  // get file status
+  struct stat info;
 
   // check file operation
-  if ( !ifile.is_open() )
+  if ( (fd < 0) || (fstat(fd, &info) < 0) )
   {
     // notify user
     error("unable to open file", filename);
 
+    // close file
+    if (fd >= 0) close(fd);
+
     // send message
     m_handler->OnEndParsing(false);
 
+    // no file is currently parsed
+    m_filename = "";
+
     // signalize trouble
     return false;
   }
 
-  // use internal method
-  bool flag = parseStream(ifile);
+  // the parser's result
+  bool flag = false;
+
+  // the mapped file
+  void* data = MAP_FAILED;
+
+  // map regular files
+  if ( S_ISREG(info.st_mode) && (info.st_size > 0) )
+  {
+    data = mmap(0, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+
+  // parse mapped file in place
+  if (data != MAP_FAILED)
+  {
+    // we are going to read the file once from start to end
+    madvise(data, info.st_size, MADV_SEQUENTIAL);
+
+    // use internal method
+    flag = parseBuffer(static_cast<const char*>(data), info.st_size);
+
+    // unmap file
+    munmap(data, info.st_size);
+  }
+
+  // fall back to read() (pipes, empty files)
+  else
+  {
+    // the file's content
+    string buffer;
+
+    // read file and use internal method
+    flag = readStream(fd, buffer) && parseBuffer(buffer.data(), buffer.size());
+  }
 
   // close file
-  ifile.close();
+  close(fd);
 
   // send message
   m_handler->OnEndParsing(flag);
@@ -203,32 +273,75 @@ bool KVParser::isKeyCharacter(char c) const
   return false;
 }
 
+// ----------
+// readStream
+// ----------
+/*
+ *
+ */
+bool KVParser::readStream(int fd, string& buffer)
+{
+  // one block of bytes
+  char block[65536];
+
+  while (true)
+  {
+    // read next block
+    ssize_t bytes = read(fd, block, sizeof(block));
+
+    // end of file
+    if (bytes == 0) break;
+
+    // read error
+    if (bytes < 0)
+    {
+      // try again
+      if (errno == EINTR) continue;
+
+      // notify user
+      error("unable to read file", m_filename);
+
+      // signalize trouble
+      return false;
+    }
+
+    // append block
+    buffer.append(block, bytes);
+  }
+
+  // signalize success
+  return true;
+}
+
 // -----------
-// parseStream
+// parseBuffer
 // -----------
 /*
  *
  */
-bool KVParser::parseStream(istream& stream)
+bool KVParser::parseBuffer(const char* data, size_t size)
 {
   // the parser's state
   enum { FIRST, KEY, VALUE, COMMENT, CORRUPTED } state = FIRST;
 
-  // buffers
-  string key = "";
-  string val = "";
+  // buffers (their capacity is reused for all lines)
+  string key;
+  string val;
 
   // line number
   unsigned lno = 1;
 
-  // one extracted byte
-  char c = 0;
+  // current position
+  const char* pos = data;
 
-  // get all bytes from given stream
-  while( stream.get(c) )
+  // end of data
+  const char* end = data + size;
+
+  // parse one line per cycle
+  while (pos < end)
   {
-    // check handler first regardless of current state
-    if ( !(m_handler->healthy()) )
+    // check flag first (the handler can only raise it in OnData)
+    if (m_abort)
     {
       // set final state
       state = CORRUPTED;
@@ -237,148 +350,146 @@ bool KVParser::parseStream(istream& stream)
       break;
     }
 
-    // FIRST
-    if (state == FIRST)
-    {
-      // empty line found
-      if (c == 10)
-      {
-        // step counter
-        lno += 1;
-      }
+    // allow initial white space
+    while ( (pos < end) && ((*pos == 9) || (*pos == 32)) ) pos++;
 
-      // comment found
-      else if (c == '#')
-      {
-        // set next state
-        state = COMMENT;
-      }
+    // only white space left
+    if (pos == end) break;
 
-      // valid start character found
-      else if ( isKeyStartCharacter(c) )
-      {
-        // append current character
-        key += c;
+    // empty line found
+    if (*pos == 10)
+    {
+      // step counter
+      lno += 1;
 
-        // set netxt state
-        state = KEY;
-      }
+      // next line
+      pos += 1;
 
-      else
-      {
-        // allow initial white space
-        if ((c != 9) && (c != 32))
-        {
-          // send error message
-          error(lno, "a key must not start with this character", c);
-
-          // set final state
-          state = CORRUPTED;
-
-          // exit loop
-          break;
-        }
-      }
+      // next cycle
+      continue;
     }
 
-    // KEY
-    else if (state == KEY)
+    // comment found
+    if (*pos == '#')
     {
-      // end of line character found
-      if (c == 10)
-      {
-        // send error message
-        error(lno, "end of line not allowed here");
+      // find end of line
+      const char* eol = static_cast<const char*>( memchr(pos, 10, end - pos) );
 
+      // missing end of line
+      if (eol == 0)
+      {
         // set final state
-        state = CORRUPTED;
+        state = COMMENT;
 
         // exit loop
         break;
       }
 
-      // key finished
-      else if (c == '=')
-      {
-        // invalid key
-        if (key.empty())
-        {
-          // send error message
-          error(lno, "empty key found");
+      // step line counter
+      lno += 1;
 
-          // set final state
-          state = CORRUPTED;
+      // next line
+      pos = eol + 1;
 
-          // exit loop
-          break;
-        }
+      // next cycle
+      continue;
+    }
 
-        // set next state
-        state = VALUE;
-      }
+    // invalid start character found
+    if ( !isKeyStartCharacter(*pos) )
+    {
+      // send error message
+      error(lno, "a key must not start with this character", *pos);
 
-      // valid key character found
-      else if ( isKeyCharacter(c) )
-      {
-        // append current character
-        key += c;
-      }
+      // set final state
+      state = CORRUPTED;
 
-      // character is not allowed to appear inside a key name
-      else
-      {
-        // send error message
-        error(lno, "a key must not contain this character", c);
+      // exit loop
+      break;
+    }
 
-        // set final state
-        state = CORRUPTED;
+    // the first character of the key
+    const char* kstart = pos;
 
-        // exit loop
-        break;
-      }
+    // skip all key characters
+    for(pos++; (pos < end) && isKeyCharacter(*pos); pos++);
+
+    // missing equals sign
+    if (pos == end)
+    {
+      // set final state
+      state = KEY;
+
+      // exit loop
+      break;
     }
 
-    // VALUE
-    else if (state == VALUE)
+    // end of line character found
+    if (*pos == 10)
     {
-      // end of line character found
-      if (c == 10)
-      {
-        // send message
-        m_handler->OnData(key, val);
+      // send error message
+      error(lno, "end of line not allowed here");
 
-        // reset buffers
-        key = "";
-        val = "";
+      // set final state
+      state = CORRUPTED;
 
-        // step line counter
-        lno += 1;
+      // exit loop
+      break;
+    }
 
-        // back to initial state
-        state = FIRST;
-      }
+    // character is not allowed to appear inside a key name
+    if (*pos != '=')
+    {
+      // send error message
+      error(lno, "a key must not contain this character", *pos);
 
-      // normal character found
-      else
-      {
-        // append current character
-        val += c;
-      }
+      // set final state
+      state = CORRUPTED;
+
+      // exit loop
+      break;
     }
 
-    // COMMENT
-    else if (state == COMMENT)
+    // set key
+    key.assign(kstart, pos - kstart);
+
+    // skip equals sign
+    pos += 1;
+
+    // find end of value
+    const char* eol = static_cast<const char*>( memchr(pos, 10, end - pos) );
+
+    // missing end of line
+    if (eol == 0)
     {
-      // end of line character found
-      if (c == 10)
-      {
-        // step line counter
-        lno += 1;
+      // set final state
+      state = VALUE;
 
-        // set next state
-        state = FIRST;
-      }
+      // exit loop
+      break;
     }
+
+    // set value
+    val.assign(pos, eol - pos);
+
+    // get ID of the key
+    unsigned keyID = m_keys.intern(key);
+
+    // send message
+    m_handler->OnData(keyID, m_keys.name(keyID), val);
+
+    // step line counter
+    lno += 1;
+
+    // next line
+    pos = eol + 1;
+  }
+
+  // the handler may have raised the flag on the last line
+  if ( (state == FIRST) && m_abort )
+  {
+    // set final state
+    state = CORRUPTED;
   }
 
   // check final state
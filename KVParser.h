@@ -20,7 +20,8 @@
 // Includes                                                             Includes
 // -----------------------------------------------------------------------------
 #include <string>
-#include <istream>
+#include <cstddef>
+#include "KeyTable.h"
 
 
 // -----------------------------------------------------------------------------
@@ -118,13 +119,23 @@ protected:
    */
   bool isKeyCharacter(char c) const;
 
+  // ----------
+  // readStream
+  // ----------
+  /**
+   * @brief  This method reads everything from the given file descriptor.
+   *
+   * It is used for pipes and other files that can't be mapped.
+   */
+  bool readStream(int fd, string& buffer);
+
   // -----------
-  // parseStream
+  // parseBuffer
   // -----------
   /**
-   *
+   * @brief  This method parses the given bytes in place.
    */
-  bool parseStream(istream& stream);
+  bool parseBuffer(const char* data, size_t size);
 
   // -----
   // error
@@ -171,6 +182,12 @@ private:
   /// this handler wiil receive all messages
   KVHandler* m_handler;
 
+  /// this flag is raised by the handler when it gets stuck
+  bool m_abort;
+
+  /// the IDs of all keys seen so far
+  KeyTable m_keys;
+
 };
 
 #endif  /* #ifndef KVPARSER_H_INCLUDE_NO1 */
@@ -0,0 +1,83 @@
+// -----------------------------------------------------------------------------
+// KeyTable.cpp                                                     KeyTable.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref KeyTable class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include "keyinfo.h"
+#include "KeyTable.h"
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// --------
+// KeyTable
+// --------
+/*
+ *
+ */
+KeyTable::KeyTable()
+{
+  // start with all defined keys
+  for(unsigned i = 0; i < keyinfo::keyCount; i++)
+  {
+    m_names.push_back( keyinfo::name(i) );
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// ------
+// intern
+// ------
+/*
+ *
+ */
+unsigned KeyTable::intern(const string& key)
+{
+  // check defined keys first
+  unsigned keyID = keyinfo::find(key);
+
+  // defined key found
+  if (keyID < keyinfo::keyCount) return keyID;
+
+  // search other keys
+  unordered_map<string, unsigned>::const_iterator it = m_ids.find(key);
+
+  // key already known
+  if (it != m_ids.end()) return it->second;
+
+  // get next free ID
+  keyID = m_names.size();
+
+  // add key
+  m_names.push_back(key);
+  m_ids[key] = keyID;
+
+  // return new ID
+  return keyID;
+}
+
+// ----
+// name
+// ----
+/*
+ *
+ */
+const string& KeyTable::name(unsigned keyID) const
+{
+  return m_names[keyID];
+}
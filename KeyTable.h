@@ -0,0 +1,99 @@
+// -----------------------------------------------------------------------------
+// KeyTable.h                                                         KeyTable.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref KeyTable class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef KEYTABLE_H_INCLUDE_NO1
+#define KEYTABLE_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// --------
+// KeyTable
+// --------
+/**
+ * @brief  This class maps key names to numeric IDs.
+ *
+ * The keys defined in keyinfo::KEYID keep their IDs. All other keys
+ * (usually the ones starting with an underscore) get the IDs following
+ * keyinfo::keyCount in the order they are seen for the first time.
+ */
+class KeyTable
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // --------
+  // KeyTable
+  // --------
+  /**
+   * @brief  The standard-constructor.
+   */
+  KeyTable();
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // ------
+  // intern
+  // ------
+  /**
+   * @brief  This method returns the ID of the given key and adds
+   *         unknown keys to the table.
+   */
+  unsigned intern(const string& key);
+
+  // ----
+  // name
+  // ----
+  /**
+   * @brief  This method returns the name of the given ID.
+   *
+   * The returned reference stays valid as long as the table exists.
+   */
+  const string& name(unsigned keyID) const;
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the names of all IDs (a deque doesn't move its elements)
+  deque<string> m_names;
+
+  /// the IDs of all keys that are not defined in keyinfo::KEYID
+  unordered_map<string, unsigned> m_ids;
+
+};
+
+#endif  /* #ifndef KEYTABLE_H_INCLUDE_NO1 */
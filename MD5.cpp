@@ -0,0 +1,198 @@
+// -----------------------------------------------------------------------------
+// MD5.cpp                                                               MD5.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref MD5 class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <cstring>
+#include "MD5.h"
+
+
+// -----------------------------------------------------------------------------
+// Helper functions                                             Helper functions
+// -----------------------------------------------------------------------------
+
+/// the shift amounts of each round
+static const unsigned shifts[64] =
+{
+  7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+  5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+  4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+  6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+};
+
+/// the constants of each step (integer part of abs(sin(i + 1)) * 2^32)
+static const uint32_t constants[64] =
+{
+  0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+  0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+  0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+  0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+  0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+  0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+  0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+  0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+};
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// ---
+// MD5
+// ---
+/*
+ *
+ */
+MD5::MD5()
+: m_size(0)
+{
+  // initial state
+  m_state[0] = 0x67452301;
+  m_state[1] = 0xefcdab89;
+  m_state[2] = 0x98badcfe;
+  m_state[3] = 0x10325476;
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// ------
+// update
+// ------
+/*
+ *
+ */
+void MD5::update(const char* data, size_t size)
+{
+  // abbreviation
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+
+  // the number of buffered bytes
+  size_t used = m_size % 64;
+  m_size += size;
+
+  // complete buffered block
+  if (used > 0)
+  {
+    size_t count = (size < 64 - used) ? size : (64 - used);
+    memcpy(m_buffer + used, bytes, count);
+    bytes += count;
+    size  -= count;
+    used  += count;
+
+    // block still incomplete
+    if (used < 64) return;
+
+    process(m_buffer);
+  }
+
+  // process whole blocks
+  for(; size >= 64; bytes += 64, size -= 64)
+  {
+    process(bytes);
+  }
+
+  // buffer the rest
+  memcpy(m_buffer, bytes, size);
+}
+
+// ------
+// digest
+// ------
+/*
+ *
+ */
+string MD5::digest()
+{
+  // the size of the message in bits
+  uint64_t bits = m_size * 8;
+
+  // append 0x80 and zeros up to 56 bytes (mod 64)
+  char padding[64] = { static_cast<char>(0x80) };
+  update(padding, ((m_size % 64) < 56) ? (56 - m_size % 64) : (120 - m_size % 64));
+
+  // append size (little endian)
+  char length[8];
+  for(unsigned i = 0; i < 8; i++)
+  {
+    length[i] = static_cast<char>( (bits >> (8 * i)) & 0xFF );
+  }
+  update(length, 8);
+
+  // get state (little endian)
+  string result;
+  for(unsigned i = 0; i < 16; i++)
+  {
+    result += static_cast<char>( (m_state[i / 4] >> (8 * (i % 4))) & 0xFF );
+  }
+
+  // return digest
+  return result;
+}
+
+
+// -----------------------------------------------------------------------------
+// Internal methods                                             Internal methods
+// -----------------------------------------------------------------------------
+
+// -------
+// process
+// -------
+/*
+ *
+ */
+void MD5::process(const unsigned char* block)
+{
+  // get words (little endian)
+  uint32_t words[16];
+  for(unsigned i = 0; i < 16; i++)
+  {
+    words[i] = static_cast<uint32_t>(block[4 * i])
+             | static_cast<uint32_t>(block[4 * i + 1]) << 8
+             | static_cast<uint32_t>(block[4 * i + 2]) << 16
+             | static_cast<uint32_t>(block[4 * i + 3]) << 24;
+  }
+
+  // working variables
+  uint32_t a = m_state[0];
+  uint32_t b = m_state[1];
+  uint32_t c = m_state[2];
+  uint32_t d = m_state[3];
+
+  // 64 steps
+  for(unsigned i = 0; i < 64; i++)
+  {
+    uint32_t f;
+    unsigned g;
+
+    if (i < 16)      { f = (b & c) | (~b & d); g = i;                }
+    else if (i < 32) { f = (d & b) | (~d & c); g = (5 * i + 1) % 16; }
+    else if (i < 48) { f = b ^ c ^ d;          g = (3 * i + 5) % 16; }
+    else             { f = c ^ (b | ~d);       g = (7 * i) % 16;     }
+
+    f += a + constants[i] + words[g];
+    a = d;
+    d = c;
+    c = b;
+    b += (f << shifts[i]) | (f >> (32 - shifts[i]));
+  }
+
+  // update state
+  m_state[0] += a;
+  m_state[1] += b;
+  m_state[2] += c;
+  m_state[3] += d;
+}
+
@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------
+// MD5.h                                                                   MD5.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref MD5 class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef MD5_H_INCLUDE_NO1
+#define MD5_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <string>
+#include <cstdint>
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// ---
+// MD5
+// ---
+/**
+ * @brief  This class computes the MD5 digest (RFC 1321) of a stream of
+ *         bytes, e.g. the audio data of a flac file.
+ */
+class MD5
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // ---
+  // MD5
+  // ---
+  /**
+   * @brief  The standard-constructor.
+   */
+  MD5();
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // ------
+  // update
+  // ------
+  /**
+   * @brief  This method appends the given bytes to the stream.
+   */
+  void update(const char* data, size_t size);
+
+  // ------
+  // digest
+  // ------
+  /**
+   * @brief  This method finishes the stream and returns the 16 bytes of
+   *         the digest.
+   */
+  string digest();
+
+
+protected:
+
+  // ---------------------------------------------------------------------------
+  // Internal methods                                           Internal methods
+  // ---------------------------------------------------------------------------
+
+  // -------
+  // process
+  // -------
+  /**
+   * @brief  This method processes one block of 64 bytes.
+   */
+  void process(const unsigned char* block);
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the state (A, B, C, D)
+  uint32_t m_state[4];
+
+  /// the number of bytes processed
+  uint64_t m_size;
+
+  /// the bytes of the incomplete block
+  unsigned char m_buffer[64];
+
+};
+
+#endif  /* #ifndef MD5_H_INCLUDE_NO1 */
+
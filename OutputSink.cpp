@@ -0,0 +1,259 @@
+// -----------------------------------------------------------------------------
+// OutputSink.cpp                                                 OutputSink.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref OutputSink class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include "OutputSink.h"
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// ----------
+// OutputSink
+// ----------
+/*
+ *
+ */
+OutputSink::OutputSink(int fd, size_t size)
+: m_fd(fd), m_owner(false), m_failed(false), m_spilled(false), m_buffer(size)
+{
+  // use the whole buffer
+  setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+}
+
+// -----------
+// ~OutputSink
+// -----------
+/*
+ *
+ */
+OutputSink::~OutputSink()
+{
+  // write remaining data
+  close();
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// ----
+// open
+// ----
+/*
+ *
+ */
+bool OutputSink::open(const string& filename)
+{
+  // close previous file
+  close();
+
+  // create file
+  m_fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+
+  // unable to open file
+  if (m_fd < 0) return false;
+
+  // update state
+  m_owner  = true;
+  m_failed = false;
+
+  // signalize success
+  return true;
+}
+
+// -----
+// flush
+// -----
+/*
+ *
+ */
+bool OutputSink::flush()
+{
+  // write buffered data
+  if ( !writeData(pbase(), pptr() - pbase()) ) m_failed = true;
+
+  // empty buffer
+  setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+  m_spilled = false;
+
+  // return state
+  return !m_failed;
+}
+
+// -------
+// discard
+// -------
+/*
+ *
+ */
+bool OutputSink::discard()
+{
+  // part of the data has been written already
+  if (m_spilled) return false;
+
+  // empty buffer
+  setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+
+  // signalize success
+  return true;
+}
+
+// -----
+// close
+// -----
+/*
+ *
+ */
+bool OutputSink::close()
+{
+  // write remaining data
+  bool success = flush();
+
+  // close opened file
+  if (m_owner)
+  {
+    if (::close(m_fd) != 0) success = false;
+
+    m_owner = false;
+    m_fd    = -1;
+  }
+
+  // return state
+  return success;
+}
+
+
+// -----------------------------------------------------------------------------
+// Stream buffer                                                   Stream buffer
+// -----------------------------------------------------------------------------
+
+// --------
+// overflow
+// --------
+/*
+ *
+ */
+OutputSink::int_type OutputSink::overflow(int_type c)
+{
+  // make room
+  if ( !flush() ) return traits_type::eof();
+  m_spilled = true;
+
+  // store character
+  if ( !traits_type::eq_int_type(c, traits_type::eof()) )
+  {
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+  }
+
+  // signalize success
+  return traits_type::not_eof(c);
+}
+
+// ------
+// xsputn
+// ------
+/*
+ *
+ */
+streamsize OutputSink::xsputn(const char* s, streamsize n)
+{
+  // data fits into the buffer
+  if (n <= epptr() - pptr())
+  {
+    traits_type::copy(pptr(), s, n);
+    pbump(n);
+
+    return n;
+  }
+
+  // make room
+  if ( !flush() ) return 0;
+  m_spilled = true;
+
+  // large blocks are written directly
+  if ( n >= static_cast<streamsize>(m_buffer.size()) )
+  {
+    if ( !writeData(s, n) )
+    {
+      m_failed = true;
+
+      return 0;
+    }
+
+    return n;
+  }
+
+  // buffer data
+  traits_type::copy(pptr(), s, n);
+  pbump(n);
+
+  return n;
+}
+
+// ----
+// sync
+// ----
+/*
+ *
+ */
+int OutputSink::sync()
+{
+  return flush() ? 0 : -1;
+}
+
+
+// -----------------------------------------------------------------------------
+// Internal methods                                             Internal methods
+// -----------------------------------------------------------------------------
+
+// ---------
+// writeData
+// ---------
+/*
+ *
+ */
+bool OutputSink::writeData(const char* data, size_t size)
+{
+  // nothing to write
+  if (size == 0) return true;
+
+  // no file descriptor
+  if (m_fd < 0) return false;
+
+  // write everything
+  while (size > 0)
+  {
+    ssize_t n = ::write(m_fd, data, size);
+
+    // interrupted by signal
+    if ( (n < 0) && (errno == EINTR) ) continue;
+
+    // write error
+    if (n <= 0) return false;
+
+    // next part
+    data += n;
+    size -= n;
+  }
+
+  // signalize success
+  return true;
+}
+
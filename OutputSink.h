@@ -0,0 +1,189 @@
+// -----------------------------------------------------------------------------
+// OutputSink.h                                                     OutputSink.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref OutputSink class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef OUTPUTSINK_H_INCLUDE_NO1
+#define OUTPUTSINK_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include <streambuf>
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// ----------
+// OutputSink
+// ----------
+/**
+ * @brief  A stream buffer that writes large blocks to a file descriptor.
+ *
+ * Data is only written when the buffer is full or when flush() or close()
+ * is called; std::endl is not needed (and would defeat the buffer).
+ * Usage:
+ *
+ *     OutputSink sink(1);
+ *     ostream out(&sink);
+ *     out << "line" << '\n';
+ *     sink.flush();
+ */
+class OutputSink : public streambuf
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // ----------
+  // OutputSink
+  // ----------
+  /**
+   * @brief  The standard-constructor.
+   *
+   * @param fd    holds the file descriptor to write to (-1: none yet).
+   * @param size  holds the size of the buffer.
+   */
+  OutputSink(int fd = -1, size_t size = 256 * 1024);
+
+  // -----------
+  // ~OutputSink
+  // -----------
+  /**
+   * @brief  The destructor flushes the buffer and closes an opened file.
+   */
+  virtual ~OutputSink();
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // ----
+  // open
+  // ----
+  /**
+   * @brief  This method creates (or truncates) the given file.
+   */
+  bool open(const string& filename);
+
+  // -----
+  // flush
+  // -----
+  /**
+   * @brief  This method writes all buffered data.
+   *
+   * @return  false if any write failed since the sink was opened
+   */
+  bool flush();
+
+  // -------
+  // discard
+  // -------
+  /**
+   * @brief  This method drops the data put since the last flush().
+   *
+   * @return  false if a full buffer has already written part of it
+   *          (nothing is dropped in this case)
+   */
+  bool discard();
+
+  // -----
+  // close
+  // -----
+  /**
+   * @brief  This method flushes the buffer and closes an opened file.
+   *
+   * @return  false if any write failed since the sink was opened
+   */
+  bool close();
+
+
+protected:
+
+  // ---------------------------------------------------------------------------
+  // Stream buffer                                                 Stream buffer
+  // ---------------------------------------------------------------------------
+
+  // --------
+  // overflow
+  // --------
+  /**
+   *
+   */
+  virtual int_type overflow(int_type c);
+
+  // ------
+  // xsputn
+  // ------
+  /**
+   *
+   */
+  virtual streamsize xsputn(const char* s, streamsize n);
+
+  // ----
+  // sync
+  // ----
+  /**
+   *
+   */
+  virtual int sync();
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Internal methods                                           Internal methods
+  // ---------------------------------------------------------------------------
+
+  // ---------
+  // writeData
+  // ---------
+  /**
+   *
+   */
+  bool writeData(const char* data, size_t size);
+
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the file descriptor
+  int m_fd;
+
+  /// the file descriptor has been opened by open()
+  bool m_owner;
+
+  /// a write failed
+  bool m_failed;
+
+  /// a full buffer has been written since the last flush()
+  bool m_spilled;
+
+  /// the buffer
+  vector<char> m_buffer;
+
+};
+
+#endif  /* #ifndef OUTPUTSINK_H_INCLUDE_NO1 */
+
@@ -34,7 +34,8 @@ using namespace std;
 /*
  *
  */
-OverviewHandler::OverviewHandler(bool detailed)
+OverviewHandler::OverviewHandler(bool detailed, ostream& out)
+: m_out(out)
 {
   // set verbosity level
   m_detailed = detailed;
@@ -57,8 +58,7 @@ void OverviewHandler::OnBeginParsing(const string& filename)
   setHealthy();
 
   // empty buffers
-  m_keys.clear();
-  m_values.clear();
+  m_track.clear();
 }
 
 // ------------
@@ -70,8 +70,7 @@ void OverviewHandler::OnBeginParsing(const string& filename)
 void OverviewHandler::OnEndParsing(bool healthy)
 {
   // empty buffers
-  m_keys.clear();
-  m_values.clear();
+  m_track.clear();
 }
 
 // ------
@@ -80,17 +79,16 @@ void OverviewHandler::OnEndParsing(bool healthy)
 /*
  *
  */
-void OverviewHandler::OnData(const string& key, const string& value)
+void OverviewHandler::OnData(unsigned keyID, const string& key, const string& value)
 {
   // don't run in bad state
   if ( !healthy() ) return;
 
   // buffer tag
-  m_keys.push_back(key);
-  m_values.push_back(value);
+  m_track.add(keyID, key, value);
 
   // trigger found
-  if ( key == keyinfo::name(keyinfo::COMPILATIONINDEX) )
+  if (keyID == keyinfo::COMPILATIONINDEX)
   {
     if (m_detailed)
     {
@@ -103,8 +101,7 @@ void OverviewHandler::OnData(const string& key, const string& value)
     }
 
     // empty buffers
-    m_keys.clear();
-    m_values.clear();
+    m_track.clear();
   }
 }
 
@@ -113,27 +110,6 @@ void OverviewHandler::OnData(const string& key, const string& value)
 // Internal methods                                             Internal methods
 // -----------------------------------------------------------------------------
 
-// --------
-// getValue
-// --------
-/*
- *
- */
-string OverviewHandler::getValue(const string& key) const
-{
-  // find related value
-  for(unsigned i = 0; i < m_keys.size(); i++)
-  {
-    if (m_keys[i] == key)
-    {
-      return m_values[i];
-    }
-  }
-
-  // key not found
-  return "";
-}
-
 // ---------
 // showBrief
 // ---------
@@ -143,32 +119,32 @@ string OverviewHandler::getValue(const string& key) const
 void OverviewHandler::showBrief() const
 {
   // get album and track artist
-  string aa = getValue( keyinfo::name(keyinfo::ALBUMARTIST) );
-  string ta = getValue( keyinfo::name(keyinfo::ARTIST) );
+  const string& aa = m_track.get(keyinfo::ALBUMARTIST);
+  const string& ta = m_track.get(keyinfo::ARTIST);
 
   // same artist
   if (aa == ta)
   {
     // print one line
-    cout << setw(3) << right
-         << getValue( keyinfo::name(keyinfo::COMPILATIONINDEX) ) << ". "
-         << getValue( keyinfo::name(keyinfo::ALBUMARTIST)      ) << " - "
-         << getValue( keyinfo::name(keyinfo::ALBUM)            ) << " - ["
-         << getValue( keyinfo::name(keyinfo::TRACKNUMBER)      ) << "] "
-         << getValue( keyinfo::name(keyinfo::TITLE)            ) << endl;
+    m_out << setw(3) << right
+          << m_track.get(keyinfo::COMPILATIONINDEX) << ". "
+          << m_track.get(keyinfo::ALBUMARTIST)      << " - "
+          << m_track.get(keyinfo::ALBUM)            << " - ["
+          << m_track.get(keyinfo::TRACKNUMBER)      << "] "
+          << m_track.get(keyinfo::TITLE)            << '\n';
   }
 
   // different artists
   else
   {
     // print one line
-    cout << setw(3) << right
-         << getValue( keyinfo::name(keyinfo::COMPILATIONINDEX) ) << ". "
-         << getValue( keyinfo::name(keyinfo::ALBUMARTIST)      ) << " - "
-         << getValue( keyinfo::name(keyinfo::ALBUM)            ) << " - ["
-         << getValue( keyinfo::name(keyinfo::TRACKNUMBER)      ) << "] "
-         << getValue( keyinfo::name(keyinfo::ARTIST)           ) << " - "
-         << getValue( keyinfo::name(keyinfo::TITLE)            ) << endl;
+    m_out << setw(3) << right
+          << m_track.get(keyinfo::COMPILATIONINDEX) << ". "
+          << m_track.get(keyinfo::ALBUMARTIST)      << " - "
+          << m_track.get(keyinfo::ALBUM)            << " - ["
+          << m_track.get(keyinfo::TRACKNUMBER)      << "] "
+          << m_track.get(keyinfo::ARTIST)           << " - "
+          << m_track.get(keyinfo::TITLE)            << '\n';
   }
 }
 
@@ -181,43 +157,48 @@ void OverviewHandler::showBrief() const
 void OverviewHandler::showVerbose() const
 {
   // print comments in this order
-  vector<string> order;
-  order.push_back( keyinfo::name(keyinfo::IMAGE)            );
-  order.push_back( keyinfo::name(keyinfo::COMPILATIONID)    );
-  order.push_back( keyinfo::name(keyinfo::COMPILATIONINDEX) );
-  order.push_back( keyinfo::name(keyinfo::AUTHOR)           );
-  order.push_back( keyinfo::name(keyinfo::COMPOSER)         );
-  order.push_back( keyinfo::name(keyinfo::LYRICIST)         );
-  order.push_back( keyinfo::name(keyinfo::OPUS)             );
-  order.push_back( keyinfo::name(keyinfo::VERSION)          );
-  order.push_back( keyinfo::name(keyinfo::ARRANGER)         );
-  order.push_back( keyinfo::name(keyinfo::PERFORMER)        );
-  order.push_back( keyinfo::name(keyinfo::CONDUCTOR)        );
-  order.push_back( keyinfo::name(keyinfo::ENSEMBLE)         );
-  order.push_back( keyinfo::name(keyinfo::ALBUMARTIST)      );
-  order.push_back( keyinfo::name(keyinfo::ALBUM)            );
-  order.push_back( keyinfo::name(keyinfo::GENRE)            );
-  order.push_back( keyinfo::name(keyinfo::DATE)             );
-  order.push_back( keyinfo::name(keyinfo::TRACKTOTAL)       );
-  order.push_back( keyinfo::name(keyinfo::TRACKNUMBER)      );
-  order.push_back( keyinfo::name(keyinfo::ARTIST)           );
-  order.push_back( keyinfo::name(keyinfo::TITLE)            );
-  order.push_back( keyinfo::name(keyinfo::COMMENT)          );
-  order.push_back( keyinfo::name(keyinfo::FILENAME)         );
+  static const keyinfo::KEYID order[] =
+  {
+    keyinfo::IMAGE,
+    keyinfo::COMPILATIONID,
+    keyinfo::COMPILATIONINDEX,
+    keyinfo::AUTHOR,
+    keyinfo::COMPOSER,
+    keyinfo::LYRICIST,
+    keyinfo::OPUS,
+    keyinfo::VERSION,
+    keyinfo::ARRANGER,
+    keyinfo::PERFORMER,
+    keyinfo::CONDUCTOR,
+    keyinfo::ENSEMBLE,
+    keyinfo::ALBUMARTIST,
+    keyinfo::ALBUM,
+    keyinfo::GENRE,
+    keyinfo::DATE,
+    keyinfo::TRACKTOTAL,
+    keyinfo::TRACKNUMBER,
+    keyinfo::ARTIST,
+    keyinfo::TITLE,
+    keyinfo::COMMENT,
+    keyinfo::FILENAME
+  };
+
+  // number of keys in this order
+  static const unsigned count = sizeof(order) / sizeof(order[0]);
 
   showBrief();
 
   // show sequence
-  for(unsigned n = 0; n < order.size(); n++)
+  for(unsigned n = 0; n < count; n++)
   {
-    cout << setw(21) << right
-         << order[n]
-         << "="
-         << getValue(order[n])
-         << endl;
+    m_out << setw(21) << right
+          << keyinfo::name(order[n])
+          << "="
+          << m_track.get(order[n])
+          << '\n';
   }
 
   // add empty line
-  cout << endl;
+  m_out << '\n';
 }
 
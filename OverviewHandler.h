@@ -21,7 +21,9 @@
 // -----------------------------------------------------------------------------
 #include <vector>
 #include <string>
+#include <iostream>
 #include "KVHandler.h"
+#include "TrackRecord.h"
 
 
 // -----------------------------------------------------------------------------
@@ -50,8 +52,11 @@ public:
   // ---------------
   /**
    * @brief  The standard-constructor.
+   *
+   * @param detailed  selects the verbose overview.
+   * @param out       holds the stream that receives the overview.
    */
-  OverviewHandler(bool detailed = false);
+  OverviewHandler(bool detailed = false, ostream& out = cout);
 
 
   // ---------------------------------------------------------------------------
@@ -80,7 +85,7 @@ public:
   /**
    *
    */
-  virtual void OnData(const string& key, const string& value);
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
 
 
 protected:
@@ -89,14 +94,6 @@ protected:
   // Internal methods                                           Internal methods
   // ---------------------------------------------------------------------------
 
-  // --------
-  // getValue
-  // --------
-  /**
-   *
-   */
-  string getValue(const string& key) const;
-
   // ---------
   // showBrief
   // ---------
@@ -120,14 +117,14 @@ private:
   // Attributes                                                       Attributes
   // ---------------------------------------------------------------------------
 
+  /// the stream that receives the overview
+  ostream& m_out;
+
   /// brief or verbose
   bool m_detailed;
 
-  /// buffer of keys
-  vector<string> m_keys;
-
-  /// buffer of values
-  vector<string> m_values;
+  /// the tags of the current track
+  TrackRecord m_track;
 
 };
 
@@ -0,0 +1,201 @@
+// -----------------------------------------------------------------------------
+// QueryHandler.cpp                                             QueryHandler.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref QueryHandler class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <algorithm>
+#include "utf8.h"
+#include "keyinfo.h"
+#include "QueryHandler.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// ------------
+// QueryHandler
+// ------------
+/*
+ *
+ */
+QueryHandler::QueryHandler(const vector<string>& columns, bool distinct, ostream& out)
+: m_columns(columns),
+  m_distinct(distinct),
+  m_out(out)
+{
+  // initialization
+}
+
+
+// -----------------------------------------------------------------------------
+// Callback handler                                             Callback handler
+// -----------------------------------------------------------------------------
+
+// --------------
+// OnBeginParsing
+// --------------
+/*
+ *
+ */
+void QueryHandler::OnBeginParsing(const string& filename)
+{
+  // update healthy flag
+  setHealthy();
+
+  // set current filename
+  m_filename = filename;
+
+  // empty buffers
+  m_track.clear();
+}
+
+// ------------
+// OnEndParsing
+// ------------
+/*
+ *
+ */
+void QueryHandler::OnEndParsing(bool healthy)
+{
+  // reset filename
+  m_filename = "";
+
+  // empty buffers
+  m_track.clear();
+}
+
+// ------
+// OnData
+// ------
+/*
+ *
+ */
+void QueryHandler::OnData(unsigned keyID, const string& key, const string& value)
+{
+  // don't run in bad state
+  if ( !healthy() ) return;
+
+  // buffer tag
+  m_track.add(keyID, key, value);
+
+  // trigger found
+  if (keyID == keyinfo::COMPILATIONINDEX)
+  {
+    // collect columns
+    addRow();
+
+    // empty buffers
+    m_track.clear();
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// -----
+// print
+// -----
+/*
+ *
+ */
+void QueryHandler::print(const vector<unsigned>& order, bool collate) const
+{
+  // the positions of the rows in output order
+  vector<size_t> positions( m_rows.size() );
+  for(size_t i = 0; i < positions.size(); i++)
+  {
+    positions[i] = i;
+  }
+
+  // sort rows (option -l alone sorts by all columns)
+  if ( !order.empty() || collate )
+  {
+    // get sort keys (sort columns, then all columns)
+    vector< vector<string> > keys( m_rows.size() );
+    for(size_t i = 0; i < m_rows.size(); i++)
+    {
+      for(unsigned n = 0; n < order.size() + m_columns.size(); n++)
+      {
+        const string& value = m_rows[i][ (n < order.size()) ? order[n] : n - order.size() ];
+        keys[i].push_back( collate ? utf8::collationKey(value) : value );
+      }
+    }
+
+    // keep input order of equal rows
+    stable_sort(positions.begin(), positions.end(), [&](size_t a, size_t b)
+    {
+      return keys[a] < keys[b];
+    });
+  }
+
+  // print rows
+  for(size_t i = 0; i < positions.size(); i++)
+  {
+    const vector<string>& row = m_rows[ positions[i] ];
+
+    for(unsigned n = 0; n < row.size(); n++)
+    {
+      if (n > 0) m_out << '|';
+      m_out << row[n];
+    }
+
+    m_out << '\n';
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Internal methods                                             Internal methods
+// -----------------------------------------------------------------------------
+
+// ------
+// addRow
+// ------
+/*
+ *
+ */
+void QueryHandler::addRow()
+{
+  // get columns
+  vector<string> row;
+  for(unsigned n = 0; n < m_columns.size(); n++)
+  {
+    row.push_back( (m_columns[n] == "CDFILE") ? m_filename : m_track.get(m_columns[n]) );
+  }
+
+  // drop duplicates
+  if (m_distinct)
+  {
+    // join columns
+    string joined;
+    for(unsigned n = 0; n < row.size(); n++)
+    {
+      joined += row[n];
+      joined += '\0';
+    }
+
+    // row collected before
+    if ( !m_seen.insert(joined).second ) return;
+  }
+
+  // add row
+  m_rows.push_back(row);
+}
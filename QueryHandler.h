@@ -0,0 +1,161 @@
+// -----------------------------------------------------------------------------
+// QueryHandler.h                                                 QueryHandler.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref QueryHandler class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef QUERYHANDLER_H_INCLUDE_NO1
+#define QUERYHANDLER_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include <iostream>
+#include <unordered_set>
+#include "KVHandler.h"
+#include "TrackRecord.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// ------------
+// QueryHandler
+// ------------
+/**
+ * @brief  This class collects the given columns of all tracks (like the
+ *         database lines, but without the names of the keys).
+ *
+ * Rows are kept in input order, duplicates are dropped on request. The
+ * rows are printed by print() once all files have been parsed, ordered
+ * by the given sort columns (and then by all columns).
+ */
+class QueryHandler : public KVHandler
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // ------------
+  // QueryHandler
+  // ------------
+  /**
+   * @brief  The standard-constructor.
+   *
+   * @param columns   holds the keys to print (CDFILE is the name of the file).
+   * @param distinct  drops rows that have been collected before.
+   * @param out       holds the stream that receives the rows.
+   */
+  QueryHandler(const vector<string>& columns, bool distinct = false, ostream& out = cout);
+
+
+  // ---------------------------------------------------------------------------
+  // Callback handler                                           Callback handler
+  // ---------------------------------------------------------------------------
+
+  // --------------
+  // OnBeginParsing
+  // --------------
+  /**
+   *
+   */
+  virtual void OnBeginParsing(const string& filename);
+
+  // ------------
+  // OnEndParsing
+  // ------------
+  /**
+   *
+   */
+  virtual void OnEndParsing(bool healthy);
+
+  // ------
+  // OnData
+  // ------
+  /**
+   *
+   */
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // -----
+  // print
+  // -----
+  /**
+   * @brief  This method prints all rows (columns separated by '|').
+   *
+   * @param order    holds the positions of the sort columns (empty means
+   *                 input order, unless collate is set).
+   * @param collate  compares values by the collation of the current
+   *                 locale (LC_COLLATE) instead of byte by byte; without
+   *                 sort columns, the rows are sorted by all columns.
+   */
+  void print(const vector<unsigned>& order, bool collate) const;
+
+
+protected:
+
+  // ---------------------------------------------------------------------------
+  // Internal methods                                           Internal methods
+  // ---------------------------------------------------------------------------
+
+  // ------
+  // addRow
+  // ------
+  /**
+   * @brief  This method adds the columns of the buffered track.
+   */
+  void addRow();
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the keys to print
+  vector<string> m_columns;
+
+  /// drop duplicates
+  bool m_distinct;
+
+  /// the stream that receives the rows
+  ostream& m_out;
+
+  /// the file that is currently parsed
+  string m_filename;
+
+  /// the tags of the current track
+  TrackRecord m_track;
+
+  /// the rows collected so far
+  vector< vector<string> > m_rows;
+
+  /// the rows collected so far (columns separated by NUL)
+  unordered_set<string> m_seen;
+
+};
+
+#endif  /* #ifndef QUERYHANDLER_H_INCLUDE_NO1 */
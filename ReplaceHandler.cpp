@@ -13,6 +13,7 @@
 // Includes                                                             Includes
 // -----------------------------------------------------------------------------
 #include "message.h"
+#include "keyinfo.h"
 #include "ReplaceHandler.h"
 
 
@@ -49,8 +50,10 @@ void ReplaceHandler::OnBeginParsing(const string& filename)
   setHealthy();
 
   // reset stacks
-  m_keys.clear();
-  m_values.clear();
+  m_track.clear();
+
+  // forget templates of the last file
+  m_cache.clear();
 
   // notify next handler
   if (m_next)
@@ -68,8 +71,10 @@ void ReplaceHandler::OnBeginParsing(const string& filename)
 void ReplaceHandler::OnEndParsing(bool healthy)
 {
   // empty stacks
-  m_keys.clear();
-  m_values.clear();
+  m_track.clear();
+
+  // forget templates
+  m_cache.clear();
 
   // notify next handler
   if (m_next)
@@ -84,7 +89,7 @@ void ReplaceHandler::OnEndParsing(bool healthy)
 /*
  *
  */
-void ReplaceHandler::OnData(const string& key, const string& value)
+void ReplaceHandler::OnData(unsigned keyID, const string& key, const string& value)
 {
   // no handler set
   if (m_next == 0) return;
@@ -93,20 +98,19 @@ void ReplaceHandler::OnData(const string& key, const string& value)
   if ( !healthy() ) return;
 
   // buffer tags
-  m_keys.push_back(key);
-  m_values.push_back(value);
+  m_track.add(keyID, key, value);
 
   // COMPILATIONINDEX tag found
-  if (key == "COMPILATIONINDEX")
+  if (keyID == keyinfo::COMPILATIONINDEX)
   {
     // try to replace all IDs
     if ( replaceAll() )
     {
       // flush all buffered values
-      for(unsigned i = 0; i < m_keys.size(); i++)
+      for(unsigned i = 0; i < m_track.size(); i++)
       {
         // notify next handler
-        m_next->OnData(m_keys[i], m_values[i]);
+        m_next->OnData(m_track.keyID(i), m_track.key(i), m_track.value(i));
 
         // check healthy state
         if ( !(m_next->healthy()) )
@@ -127,8 +131,7 @@ void ReplaceHandler::OnData(const string& key, const string& value)
     }
 
     // empty stacks
-    m_keys.clear();
-    m_values.clear();
+    m_track.clear();
   }
 }
 
@@ -137,6 +140,14 @@ void ReplaceHandler::OnData(const string& key, const string& value)
 // Internal methods                                             Internal methods
 // -----------------------------------------------------------------------------
 
+/// states of a tag during resolve()
+enum
+{
+  PENDING,
+  ACTIVE,
+  FINAL
+};
+
 // ----------
 // replaceAll
 // ----------
@@ -145,98 +156,92 @@ void ReplaceHandler::OnData(const string& key, const string& value)
  */
 bool ReplaceHandler::replaceAll()
 {
-  bool pending = true;
-  bool updated = true;
+  // number of tags
+  unsigned count = m_track.size();
 
-  // while replacements can (and need to) be done
-  while (pending && updated)
-  {
-    // reset flags
-    pending = false;
-    updated = false;
+  // reset buffers
+  m_templates.resize(count);
+  m_states.assign(count, PENDING);
 
-    // replace all IDs
-    for(unsigned i = 0; i < m_values.size(); i++)
-    {
-      // get current value
-      const string& value = m_values[i];
-
-      // parts of a value
-      string a, id, b;
-
-      // split value
-      if ( !split(value, a, id, b) )
-      {
-        // invalid syntax
-        return false;
-      }
+  // get the template of each value
+  for(unsigned n = 0; n < count; n++)
+  {
+    m_templates[n] = compile( m_track.value(n) );
 
-      // value is already final
-      if ( id.empty() ) continue;
+    // invalid syntax
+    if (m_templates[n] == 0) return false;
+  }
 
-      // still work to be done
-      pending = true;
+  // resolve each value once
+  for(unsigned n = 0; n < count; n++)
+  {
+    if ( !resolve(n) )
+    {
+      // circular substitution
+      return false;
+    }
+  }
 
-      // get value to insert
-      string paste = getValue(id);
+  // signalize success
+  return true;
+}
 
-      // empty value specified
-      if ( paste.empty() )
-      {
-        // notify user
-        msg::wrn( msg::cat("empty substitution: $", id) );
-      }
+// -------
+// compile
+// -------
+/*
+ *
+ */
+ReplaceHandler::Template* ReplaceHandler::compile(const string& value)
+{
+  // search template
+  unordered_map<string, Template>::iterator it = m_cache.find(value);
 
-      // requested value can be inserted
-      if ( isFinal(paste) )
-      {
-        // update value
-        m_values[i] = a + paste + b;
+  // template found
+  if ( it != m_cache.end() ) return &it->second;
 
-        // set flag
-        updated = true;
-      }
-    }
-  }
+  // parse value
+  Template t;
+  if ( !parse(value, t.segments) ) return 0;
 
-  // unable to finish all values
-  if (pending)
+  // check for references
+  t.dynamic = false;
+  for(unsigned i = 0; i < t.segments.size(); i++)
   {
-    // notify user
-    msg::err("unable to finish some values");
-
-    // signalize trouble
-    return false;
+    if (t.segments[i].reference) t.dynamic = true;
   }
 
-  // signalize success
-  return true;
+  // nothing substituted yet
+  t.cached = false;
+
+  // add template
+  return &m_cache.insert( make_pair(value, t) ).first->second;
 }
 
 // -----
-// split
+// parse
 // -----
 /*
  *
  */
-bool ReplaceHandler::split(const string& s, string& a, string& id, string& b) const
+bool ReplaceHandler::parse(const string& s, vector<Segment>& segments) const
 {
-  // reset return values
-  a  = "";
-  id = "";
-  b  = "";
+  // reset return value
+  segments.clear();
+
+  // the current segment
+  Segment segment = { "", false };
 
   // parser states
   enum
   {
-    READ_PRE,
+    READ_TEXT,
     READ_ESC,
     CHECK_ID,
     READ_PLAIN_ID,
-    READ_CURLY_ID,
-    READ_POST
+    READ_CURLY_ID
   }
-  state = READ_PRE;
+  state = READ_TEXT;
 
   // parse s
   for(string::size_type i = 0; i < s.size(); i++)
@@ -244,14 +249,44 @@ bool ReplaceHandler::split(const string& s, string& a, string& id, string& b) co
     // get current character
     unsigned char uc = static_cast<unsigned char>(s[i]);
 
-    // READ_PRE
-    if (state == READ_PRE)
+    // character may be part of an ID
+    bool idchar = (uc == '_')
+               || ((uc >= 'A') && (uc <= 'Z'))
+               || ((uc >= 'a') && (uc <= 'z'))
+               || ((uc >= '0') && (uc <= '9'));
+
+    // READ_PLAIN_ID
+    if (state == READ_PLAIN_ID)
+    {
+      // ID continued
+      if (idchar)
+      {
+        // append character
+        segment.text += uc;
+
+        // next character
+        continue;
+      }
+
+      // ID finished
+      segments.push_back(segment);
+
+      // start literal text
+      segment.text = "";
+      segment.reference = false;
+
+      // parse this character as text
+      state = READ_TEXT;
+    }
+
+    // READ_TEXT
+    if (state == READ_TEXT)
     {
       // escape sequence found
       if (uc == '\\')
       {
         // don't replace escape sequences yet
-        a += uc;
+        segment.text += uc;
 
         // set next state
         state = READ_ESC;
@@ -268,7 +303,7 @@ bool ReplaceHandler::split(const string& s, string& a, string& id, string& b) co
       else
       {
         // append character
-        a += uc;
+        segment.text += uc;
       }
     }
 
@@ -276,33 +311,34 @@ bool ReplaceHandler::split(const string& s, string& a, string& id, string& b) co
     else if (state == READ_ESC)
     {
       // append this character unparsed
-      a += uc;
+      segment.text += uc;
 
       // back to initial state
-      state = READ_PRE;
+      state = READ_TEXT;
     }
 
     // CHECK_ID
     else if (state == CHECK_ID)
     {
-      // curly ID found
-      if (uc == '{')
+      // curly or plain ID found
+      if ( (uc == '{') || idchar )
       {
-        // set next state
-        state = READ_CURLY_ID;
-      }
+        // finish literal text
+        if ( !segment.text.empty() ) segments.push_back(segment);
 
-      // plain ID found
-      else if (  (uc == '_')
-      ||        ((uc >= 'A') && (uc <= 'Z'))
-      ||        ((uc >= 'a') && (uc <= 'z'))
-      ||        ((uc >= '0') && (uc <= '9')) )
-      {
-        // append character
-        id += uc;
+        // start reference
+        segment.text = "";
+        segment.reference = true;
+
+        // plain ID found
+        if (idchar)
+        {
+          // append character
+          segment.text += uc;
+        }
 
         // set next state
-        state = READ_PLAIN_ID;
+        state = (uc == '{') ? READ_CURLY_ID : READ_PLAIN_ID;
       }
 
       // invalid syntax
@@ -316,48 +352,40 @@ bool ReplaceHandler::split(const string& s, string& a, string& id, string& b) co
       }
     }
 
-    // READ_PLAIN_ID
-    else if (state == READ_PLAIN_ID)
+    // READ_CURLY_ID
+    else if (state == READ_CURLY_ID)
     {
       // ID continued
-      if (  (uc == '_')
-      ||   ((uc >= 'A') && (uc <= 'Z'))
-      ||   ((uc >= 'a') && (uc <= 'z'))
-      ||   ((uc >= '0') && (uc <= '9')) )
+      if (idchar)
       {
         // append character
-        id += uc;
+        segment.text += uc;
       }
 
-      // ID finished
-      else
+      // empty ID found
+      else if ( (uc == '}') && segment.text.empty() )
       {
-        // append character
-        b += uc;
+        // keep the rest of the value as it is
+        segment.text = s.substr(i - 2);
+        segment.reference = false;
+        segments.push_back(segment);
 
-        // set next state
-        state = READ_POST;
-      }
-    }
-
-    // READ_CURLY_ID
-    else if (state == READ_CURLY_ID)
-    {
-      // ID continued
-      if (  (uc == '_')
-      ||   ((uc >= 'A') && (uc <= 'Z'))
-      ||   ((uc >= 'a') && (uc <= 'z'))
-      ||   ((uc >= '0') && (uc <= '9')) )
-      {
-        // append character
-        id += uc;
+        // signalize success
+        return true;
       }
 
       // ID finished
       else if (uc == '}')
       {
+        // append reference
+        segments.push_back(segment);
+
+        // start literal text
+        segment.text = "";
+        segment.reference = false;
+
         // set next state
-        state = READ_POST;
+        state = READ_TEXT;
       }
 
       // invalid syntax
@@ -370,13 +398,6 @@ bool ReplaceHandler::split(const string& s, string& a, string& id, string& b) co
         return false;
       }
     }
-
-    // READ_POST
-    else if (state == READ_POST)
-    {
-      // don't parse any characters in this state
-      b += uc;
-    }
   }
 
   // check final state
@@ -391,51 +412,125 @@ bool ReplaceHandler::split(const string& s, string& a, string& id, string& b) co
     return false;
   }
 
+  // append last segment
+  if ( segment.reference || !segment.text.empty() )
+  {
+    segments.push_back(segment);
+  }
+
   // signalize success
   return true;
 }
 
-// --------
-// getValue
-// --------
+// -------
+// resolve
+// -------
 /*
  *
  */
-string ReplaceHandler::getValue(const string& key) const
+bool ReplaceHandler::resolve(unsigned n)
 {
-  // search key
-  for(unsigned i = 0; i < m_keys.size(); i++)
+  // inserted for missing tags
+  static const string empty;
+
+  // value is already final
+  if (m_states[n] == FINAL) return true;
+
+  // value depends on itself
+  if (m_states[n] == ACTIVE)
   {
-    // key found
-    if (m_keys[i] == key)
+    // notify user
+    msg::err( msg::cat("circular substitution: $", m_track.key(n)) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // get template
+  Template& t = *m_templates[n];
+
+  // nothing to replace
+  if ( !t.dynamic )
+  {
+    // value is final as it is
+    m_states[n] = FINAL;
+
+    // signalize success
+    return true;
+  }
+
+  // mark tag as being resolved
+  m_states[n] = ACTIVE;
+
+  // the last result can be reused
+  bool reuse = t.cached;
+
+  // the number of the current reference
+  unsigned r = 0;
+
+  // resolve all references
+  for(unsigned i = 0; i < t.segments.size(); i++)
+  {
+    // literal text
+    if ( !t.segments[i].reference ) continue;
+
+    // find referenced tag
+    unsigned k = m_track.position(t.segments[i].text);
+
+    // resolve referenced tag first
+    if ( (k < m_track.size()) && !resolve(k) ) return false;
+
+    // get value to insert (missing tags are empty)
+    const string& paste = (k < m_track.size()) ? m_track.value(k) : empty;
+
+    // empty value specified
+    if ( paste.empty() )
     {
-      return m_values[i];
+      // notify user
+      msg::wrn( msg::cat("empty substitution: $", t.segments[i].text) );
     }
-  }
 
-  // key not found
-  return "";
-}
+    // compare with the last input
+    if ( reuse && (t.inputs[r] != paste) ) reuse = false;
 
-// -------
-// isFinal
-// -------
-/*
- *
- */
-bool ReplaceHandler::isFinal(const string& value) const
-{
-  // parts of the given value
-  string a, id, b;
+    // remember input
+    if ( !reuse )
+    {
+      // last result is outdated
+      t.cached = false;
 
-  // split given value
-  if ( !split(value, a, id, b) )
+      if (r < t.inputs.size()) t.inputs[r] = paste; else t.inputs.push_back(paste);
+    }
+
+    // next reference
+    r++;
+  }
+
+  // substitute references
+  if ( !reuse )
   {
-    // invalid syntax
-    return false;
+    // start with empty result
+    t.result.clear();
+
+    // reset number of reference
+    r = 0;
+
+    // join segments
+    for(unsigned i = 0; i < t.segments.size(); i++)
+    {
+      t.result += t.segments[i].reference ? t.inputs[r++] : t.segments[i].text;
+    }
+
+    // result can be reused
+    t.cached = true;
   }
 
-  // value is final
-  return id.empty();
-}
+  // update value
+  m_track.value(n) = t.result;
 
+  // value is final now
+  m_states[n] = FINAL;
+
+  // signalize success
+  return true;
+}
@@ -21,7 +21,9 @@
 // -----------------------------------------------------------------------------
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include "ChainHandler.h"
+#include "TrackRecord.h"
 
 
 // -----------------------------------------------------------------------------
@@ -80,11 +82,55 @@ public:
   /**
    *
    */
-  virtual void OnData(const string& key, const string& value);
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
 
 
 protected:
 
+  // ---------------------------------------------------------------------------
+  // Types                                                                 Types
+  // ---------------------------------------------------------------------------
+
+  // -------
+  // Segment
+  // -------
+  /**
+   * @brief  A piece of a value: literal text or the name of a referenced key.
+   */
+  struct Segment
+  {
+    /// the literal text or the name of the key
+    string text;
+
+    /// text holds the name of a key
+    bool reference;
+  };
+
+  // --------
+  // Template
+  // --------
+  /**
+   * @brief  A parsed value and the result of its last substitution.
+   */
+  struct Template
+  {
+    /// the literal text and references of the value
+    vector<Segment> segments;
+
+    /// the value contains references
+    bool dynamic;
+
+    /// result holds the substitution of inputs
+    bool cached;
+
+    /// the values inserted into the last result (one per reference)
+    vector<string> inputs;
+
+    /// the last result
+    string result;
+  };
+
+
   // ---------------------------------------------------------------------------
   // Internal methods                                           Internal methods
   // ---------------------------------------------------------------------------
@@ -97,29 +143,37 @@ protected:
    */
   bool replaceAll();
 
-  // -----
-  // split
-  // -----
+  // -------
+  // compile
+  // -------
   /**
+   * @brief  This method returns the template of the given value.
+   *
+   * Templates are cached by the raw value, so each distinct value is
+   * parsed only once per file.
    *
+   * @return  0 in case of invalid syntax
    */
-  bool split(const string& s, string& a, string& id, string& b) const;
+  Template* compile(const string& value);
 
-  // --------
-  // getValue
-  // --------
+  // -----
+  // parse
+  // -----
   /**
+   * @brief  This method splits a value into literal text and references.
    *
+   * Escape sequences are copied unparsed into the literal segments.
    */
-  string getValue(const string& key) const;
+  bool parse(const string& s, vector<Segment>& segments) const;
 
   // -------
-  // isFinal
+  // resolve
   // -------
   /**
-   *
+   * @brief  This method replaces all references of the n-th tag after
+   *         resolving the tags it depends on.
    */
-  bool isFinal(const string& value) const;
+  bool resolve(unsigned n);
 
 
 private:
@@ -128,11 +182,17 @@ private:
   // Attributes                                                       Attributes
   // ---------------------------------------------------------------------------
 
-  /// list of keys
-  vector<string> m_keys;
+  /// the tags of the current track
+  TrackRecord m_track;
+
+  /// the templates of all values seen in the current file
+  unordered_map<string, Template> m_cache;
+
+  /// the template of each tag
+  vector<Template*> m_templates;
 
-  /// list of values
-  vector<string> m_values;
+  /// the state of each tag (see resolve())
+  vector<unsigned char> m_states;
 
 };
 
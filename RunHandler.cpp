@@ -0,0 +1,277 @@
+// -----------------------------------------------------------------------------
+// RunHandler.cpp                                                 RunHandler.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref RunHandler class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "message.h"
+#include "imageinfo.h"
+#include "RunHandler.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// ----------
+// RunHandler
+// ----------
+/*
+ *
+ */
+RunHandler::RunHandler(unsigned slots, unsigned options, const string& journal, const string& cache, bool builtin)
+: ScriptHandler(cout, options),
+  m_runner(slots),
+  m_journalName(journal),
+  m_cache(cache),
+  m_encoder(slots)
+{
+  // skip finished tracks
+  if ( !m_journalName.empty() )
+  {
+    m_runner.setJournal(&m_journal);
+  }
+
+  // reuse encoded audio data
+  if ( !m_cache.directory().empty() )
+  {
+    m_runner.setCache(&m_cache);
+  }
+
+  // encode without flac
+  if (builtin)
+  {
+    m_runner.setEncoder(&m_encoder);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Callback handler                                             Callback handler
+// -----------------------------------------------------------------------------
+
+// ------------
+// OnEndParsing
+// ------------
+/*
+ *
+ */
+void RunHandler::OnEndParsing(bool healthy)
+{
+  // abbreviation
+  typedef set<string>::const_iterator itt;
+
+  if (healthy && this->healthy())
+  {
+    // the result of all checks
+    bool checked = true;
+
+    // the files of finished tracks (kept as they are)
+    set<string> finished;
+
+    // read journal
+    if ( !m_journalName.empty() )
+    {
+      if ( m_journal.open(m_journalName) )
+      {
+        for(unsigned i = 0; i < m_jobs.size(); i++)
+        {
+          if ( m_journal.done(m_jobs[i]) ) finished.insert(m_jobs[i].filename);
+        }
+      }
+
+      else
+      {
+        // notify user
+        msg::err( msg::catq("unable to open journal: ", m_journalName) );
+
+        // skip all jobs
+        checked = false;
+      }
+    }
+
+    // check images
+    for(itt it = m_ichecks.begin(); checked && (it != m_ichecks.end()); ++it)
+    {
+      checked = checkImage(*it);
+    }
+
+    // check cache directory
+    if ( checked && !m_cache.directory().empty() )
+    {
+      checked = checkDirectory(m_cache.directory());
+    }
+
+    // check directories
+    for(itt it = m_dchecks.begin(); checked && (it != m_dchecks.end()); ++it)
+    {
+      checked = checkDirectory(*it);
+    }
+
+    // check files
+    for(itt it = m_fchecks.begin(); checked && (it != m_fchecks.end()); ++it)
+    {
+      if ( finished.count(*it) == 0 ) checked = checkFile(*it);
+    }
+
+    // run jobs
+    if ( !checked || !m_runner.run(m_jobs) )
+    {
+      // update healthy flag
+      setHealthy(false);
+    }
+  }
+
+  // empty buffers
+  reset();
+}
+
+
+// -----------------------------------------------------------------------------
+// Internal methods                                             Internal methods
+// -----------------------------------------------------------------------------
+
+// ----------
+// checkImage
+// ----------
+/*
+ * same limits as chkimage() of the tag script
+ */
+bool RunHandler::checkImage(const string& filename) const
+{
+  // read image
+  string data;
+  if ( !imageinfo::load(filename, data) )
+  {
+    // notify user
+    msg::err( msg::catq("unable to locate file: ", filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // get image properties
+  imageinfo::Info info;
+  if ( !imageinfo::inspect(data, info) )
+  {
+    // notify user
+    msg::err( msg::catq("the image must have either JPEG or PNG format: ", filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // check file size
+  if ( (info.format == "JPEG") && (data.size() > 85000) )
+  {
+    // notify user
+    msg::err( msg::ins("the image's file size should not exeed 80K (found: ~)", msg::str(static_cast<unsigned>(data.size()))) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // check file size
+  if ( (info.format == "PNG") && (data.size() > 505000) )
+  {
+    // notify user
+    msg::err( msg::ins("the image's file size should not exeed 500K (found: ~)", msg::str(static_cast<unsigned>(data.size()))) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // check dimensions
+  if ( (info.width != 300) || (info.height != 300) )
+  {
+    // notify user
+    msg::err( msg::ins("the image must must be 300px wide and 300px high (found: ~)", msg::str(info.width) + "x" + msg::str(info.height)) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // signalize success
+  return true;
+}
+
+// --------------
+// checkDirectory
+// --------------
+/*
+ * mkdir --parents
+ */
+bool RunHandler::checkDirectory(const string& dirname) const
+{
+  // the current directory
+  if ( dirname.empty() ) return true;
+
+  // create each parent directory
+  for(string::size_type i = 1; i <= dirname.size(); i++)
+  {
+    if ( (i == dirname.size()) || (dirname[i] == '/') )
+    {
+      mkdir(dirname.substr(0, i).c_str(), 0777);
+    }
+  }
+
+  // check if directory exists
+  struct stat info;
+  if ( (stat(dirname.c_str(), &info) != 0) || !S_ISDIR(info.st_mode) )
+  {
+    // notify user
+    msg::err( msg::catq("unable to create target directory: ", dirname) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // signalize success
+  return true;
+}
+
+// ---------
+// checkFile
+// ---------
+/*
+ * truncate --size=0
+ */
+bool RunHandler::checkFile(const string& filename) const
+{
+  // try to truncate (resp. create) file
+  int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+
+  if (fd == -1)
+  {
+    // notify user
+    msg::err( msg::catq("unable to create target file: ", filename) );
+
+    // signalize trouble
+    return false;
+  }
+
+  // close file
+  close(fd);
+
+  // signalize success
+  return true;
+}
+
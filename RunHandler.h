@@ -0,0 +1,141 @@
+// -----------------------------------------------------------------------------
+// RunHandler.h                                                     RunHandler.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref RunHandler class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef RUNHANDLER_H_INCLUDE_NO1
+#define RUNHANDLER_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <string>
+#include "ScriptHandler.h"
+#include "JobRunner.h"
+#include "Journal.h"
+#include "EncodeCache.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// ----------
+// RunHandler
+// ----------
+/**
+ * @brief  This class runs the jobs of the tag script itself instead of
+ *         printing the script.
+ *
+ * The checks of the script (images, directories and files) are done
+ * before the first job is started. If a journal is given, tracks it
+ * records as done are neither truncated nor encoded again. If a cache
+ * directory is given, the audio of unchanged wav files is reused. The
+ * built-in encoder (see FlacEncoder) can replace flac.
+ */
+class RunHandler : public ScriptHandler
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // ----------
+  // RunHandler
+  // ----------
+  /**
+   * @brief  The standard-constructor.
+   *
+   * @param slots    holds the number of tracks encoded at once
+   *                 (0 means one track per processor).
+   * @param options  holds the options of the script
+   *                 (see ScriptHandler::SINGLE_PASS).
+   * @param journal  holds the name of the journal (empty means none).
+   * @param cache    holds the name of the cache directory (empty means none).
+   * @param builtin  selects the built-in encoder (slots are its threads).
+   */
+  RunHandler(unsigned slots = 0, unsigned options = 0, const string& journal = "", const string& cache = "", bool builtin = false);
+
+
+  // ---------------------------------------------------------------------------
+  // Callback handler                                           Callback handler
+  // ---------------------------------------------------------------------------
+
+  // ------------
+  // OnEndParsing
+  // ------------
+  /**
+   *
+   */
+  virtual void OnEndParsing(bool healthy);
+
+
+protected:
+
+  // ---------------------------------------------------------------------------
+  // Internal methods                                           Internal methods
+  // ---------------------------------------------------------------------------
+
+  // ----------
+  // checkImage
+  // ----------
+  /**
+   * @brief  This method checks type, size and dimension of the cover image.
+   */
+  bool checkImage(const string& filename) const;
+
+  // --------------
+  // checkDirectory
+  // --------------
+  /**
+   * @brief  This method creates the target directory (and its parents).
+   */
+  bool checkDirectory(const string& dirname) const;
+
+  // ---------
+  // checkFile
+  // ---------
+  /**
+   * @brief  This method checks if the target file can be created.
+   */
+  bool checkFile(const string& filename) const;
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// runs the jobs
+  JobRunner m_runner;
+
+  /// the name of the journal (empty if none)
+  string m_journalName;
+
+  /// the finished tracks
+  Journal m_journal;
+
+  /// the encoded audio data
+  EncodeCache m_cache;
+
+  /// the built-in encoder
+  FlacEncoder m_encoder;
+};
+
+#endif  /* #ifndef RUNHANDLER_H_INCLUDE_NO1 */
+
@@ -14,7 +14,10 @@
 // -----------------------------------------------------------------------------
 #include <iostream>
 #include <iomanip>
+#include <sstream>
 #include "keyinfo.h"
+#include "message.h"
+#include "OutputSink.h"
 #include "ScriptHandler.h"
 
 
@@ -34,7 +37,14 @@ using namespace std;
 /*
  *
  */
-ScriptHandler::ScriptHandler()
+ScriptHandler::ScriptHandler(ostream& out, unsigned options)
+: m_out(out),
+  m_parallel( (options & PARALLEL) != 0 ),
+  m_singlePass( (options & SINGLE_PASS) != 0 ),
+  m_makefile( (options & MAKEFILE) != 0 ),
+  m_compact( (options & COMPACT) != 0 ),
+  m_rows(0),
+  m_start(-1)
 {
   // nothing
 }
@@ -56,15 +66,10 @@ void ScriptHandler::OnBeginParsing(const string& filename)
   setHealthy();
 
   // empty buffers
-  m_keys.clear();
-  m_values.clear();
-  m_ichecks.clear();
-  m_dchecks.clear();
-  m_fchecks.clear();
+  reset();
 
-  // reset stringstream
-  m_fcbuffer.str("");
-  m_fcbuffer.clear();
+  // remember where the script starts (the rows are printed at once)
+  if (m_compact) m_start = m_out.tellp();
 }
 
 // ------------
@@ -75,7 +80,50 @@ void ScriptHandler::OnBeginParsing(const string& filename)
  */
 void ScriptHandler::OnEndParsing(bool healthy)
 {
-  if (healthy && this->healthy())
+  // print makefile
+  if (healthy && this->healthy() && m_makefile)
+  {
+    // names not supported by make
+    if ( !printMakefile() ) setHealthy(false);
+  }
+
+  // finish compact script (the rows are already printed)
+  else if (healthy && this->healthy() && m_compact)
+  {
+    // no track found
+    if (m_rows == 0)
+    {
+      // print initial bash code
+      beginCompactScript();
+
+      m_out << "  # nothing to do" << '\n';
+      m_out << "  return 0" << '\n';
+    }
+
+    // close encode_all()
+    m_out << "}" << '\n';
+    m_out << '\n';
+
+    // check directories, files and images
+    printCheckCommands();
+
+    m_out << "# encode all tracks" << '\n';
+    m_out << "encode_all" << '\n';
+    m_out << '\n';
+
+    // print final bash code
+    endScript();
+  }
+
+  // broken file (the rows are already printed)
+  else if (m_compact && (m_rows > 0))
+  {
+    // remove rows
+    dropCompactScript();
+  }
+
+  // print script
+  else if (healthy && this->healthy())
   {
     // print initial bash code
     beginScript();
@@ -83,23 +131,26 @@ void ScriptHandler::OnEndParsing(bool healthy)
     // check directories, files and images
     printCheckCommands();
 
-    // print buffered file commands
-    cout << m_fcbuffer.str();
+    // print file commands
+    if (m_parallel)
+    {
+      printParallelCommands();
+    }
+
+    else
+    {
+      for(unsigned i = 0; i < m_jobs.size(); i++)
+      {
+        printFileCommands(m_jobs[i]);
+      }
+    }
 
     // print final bash code
     endScript();
   }
 
   // empty buffers
-  m_keys.clear();
-  m_values.clear();
-  m_ichecks.clear();
-  m_dchecks.clear();
-  m_fchecks.clear();
-
-  // reset stringstream
-  m_fcbuffer.str("");
-  m_fcbuffer.clear();
+  reset();
 }
 
 // ------
@@ -108,24 +159,22 @@ void ScriptHandler::OnEndParsing(bool healthy)
 /*
  *
  */
-void ScriptHandler::OnData(const string& key, const string& value)
+void ScriptHandler::OnData(unsigned keyID, const string& key, const string& value)
 {
   // don't run in bad state
   if ( !healthy() ) return;
 
   // buffer tag
-  m_keys.push_back(key);
-  m_values.push_back(value);
+  m_track.add(keyID, key, value);
 
   // trigger found
-  if (key == "COMPILATIONINDEX")
+  if (keyID == keyinfo::COMPILATIONINDEX)
   {
-    // buffer bash code
-    bufferFileCommands();
+    // buffer job
+    bufferJob();
 
     // empty buffers
-    m_keys.clear();
-    m_values.clear();
+    m_track.clear();
   }
 }
 
@@ -225,182 +274,734 @@ string ScriptHandler::quote(const string& line, bool outer) const
   return quoted;
 }
 
-// --------
-// getValue
-// --------
+// ---------
+// bufferJob
+// ---------
 /*
  *
  */
-string ScriptHandler::getValue(const string& key) const
+void ScriptHandler::bufferJob()
 {
-  // find related value
-  for(unsigned i = 0; i < m_keys.size(); i++)
+  // create job
+  m_jobs.push_back( TrackJob(m_track, m_singlePass) );
+
+  // get new job
+  const TrackJob& job = m_jobs.back();
+
+  // add image check
+  if ( !job.image.empty() )
   {
-    if (m_keys[i] == key)
-    {
-      return m_values[i];
-    }
+    m_ichecks.insert(job.image);
   }
 
-  // key not found
-  return "";
+  // add directory and file checks
+  if ( !job.filename.empty() )
+  {
+    m_dchecks.insert( dirname(job.filename) );
+    m_fchecks.insert( job.filename );
+  }
+
+  // print row at once (only the checks have to be kept)
+  if (m_compact)
+  {
+    // print initial bash code
+    if (m_rows == 0) beginCompactScript();
+
+    // print row
+    printCompactRow(job);
+    m_rows++;
+
+    // forget job
+    m_jobs.pop_back();
+  }
 }
 
-// ------------------
-// bufferFileCommands
-// ------------------
+// -----------------
+// printFileCommands
+// -----------------
 /*
  *
  */
-void ScriptHandler::bufferFileCommands()
+void ScriptHandler::printFileCommands(const TrackJob& job) const
 {
-  // set comments in this order
-  vector<string> order;
-  order.push_back( keyinfo::name(keyinfo::COMPILATIONID)    );
-  order.push_back( keyinfo::name(keyinfo::COMPILATIONINDEX) );
-  order.push_back( keyinfo::name(keyinfo::AUTHOR)           );
-  order.push_back( keyinfo::name(keyinfo::COMPOSER)         );
-  order.push_back( keyinfo::name(keyinfo::LYRICIST)         );
-  order.push_back( keyinfo::name(keyinfo::OPUS)             );
-  order.push_back( keyinfo::name(keyinfo::VERSION)          );
-  order.push_back( keyinfo::name(keyinfo::ARRANGER)         );
-  order.push_back( keyinfo::name(keyinfo::PERFORMER)        );
-  order.push_back( keyinfo::name(keyinfo::CONDUCTOR)        );
-  order.push_back( keyinfo::name(keyinfo::ENSEMBLE)         );
-  order.push_back( keyinfo::name(keyinfo::ALBUMARTIST)      );
-  order.push_back( keyinfo::name(keyinfo::ALBUM)            );
-  order.push_back( keyinfo::name(keyinfo::GENRE)            );
-  order.push_back( keyinfo::name(keyinfo::DATE)             );
-  order.push_back( keyinfo::name(keyinfo::TRACKTOTAL)       );
-  order.push_back( keyinfo::name(keyinfo::TRACKNUMBER)      );
-  order.push_back( keyinfo::name(keyinfo::ARTIST)           );
-  order.push_back( keyinfo::name(keyinfo::TITLE)            );
-  order.push_back( keyinfo::name(keyinfo::COMMENT)          );
-  
-  // get special values
-  string cmpindex = getValue( keyinfo::name(keyinfo::COMPILATIONINDEX) );
-  string filename = getValue( keyinfo::name(keyinfo::FILENAME)         );
-  string image    = getValue( keyinfo::name(keyinfo::IMAGE)            );
-
-  // filenames (wav and flac)
-  string infile;
-  string outfile;
-
-  // compile filenames
-  stringstream strstr;
-  strstr << "track";
-  strstr << setw(3) << setfill('0') << cmpindex;
-  strstr << ".cdda.wav";
-  strstr << " ";
-  strstr << "track";
-  strstr << setw(3) << setfill('0') << cmpindex;
-  strstr << ".flac";
-
-  // get filenames
-  strstr >> infile >> outfile;
-
   // add empty line
-  m_fcbuffer << "# add empty line" << endl;
-  m_fcbuffer << "echo" << endl;
-  m_fcbuffer << endl;
+  m_out << "# add empty line" << '\n';
+  m_out << "echo" << '\n';
+  m_out << '\n';
 
   // start if block
-  m_fcbuffer << "# create flac file" << endl;
-  m_fcbuffer << "if [ -s " << quote(infile) << " ] ; then" << endl;
-  m_fcbuffer << endl;
+  m_out << "# create flac file" << '\n';
+  m_out << "if [ -s " << quote(job.infile) << " ] ; then" << '\n';
+  m_out << '\n';
 
-  m_fcbuffer << "  # show progress" << endl;
-  m_fcbuffer << "  infomsg \"converting " << quote(infile, false) << "\"" << endl;
-  m_fcbuffer << endl;
+  m_out << "  # show progress" << '\n';
+  m_out << "  infomsg \"converting " << quote(job.infile, false) << "\"" << '\n';
+  m_out << '\n';
 
-  // create flac command
-  m_fcbuffer << "  # convert wav to flac" << endl;
-  m_fcbuffer << "  flac --force \\" << endl;
-  m_fcbuffer << "       --verify \\" << endl;
-  m_fcbuffer << "       --compression-level-8 \\" << endl;
-  if ( !image.empty() )
+  // convert wav to flac
+  printEncodeCommands(job, false);
+
+  // start else block
+  m_out << "# missing or empty wav file" << '\n';
+  m_out << "else" << '\n';
+  m_out << '\n';
+  m_out << "  # notify user" << '\n';
+  m_out << "  warnmsg \"skipping missing (or empty) wav file: " << quote(job.infile, false) << "\"" << '\n';
+  m_out << '\n';
+
+  if ( !job.filename.empty() )
   {
-    // add check
-    m_ichecks.insert(image);
+    m_out << "  # remove (touched resp. truncated) flac file" << '\n';
+    m_out << "  rm -f " << quote(job.filename) << '\n';
+    m_out << '\n';
+  }
 
-    m_fcbuffer << "       --picture=\"3||||" << quote(image, false) << "\" \\" << endl;
+  m_out << "fi" << '\n';
+  m_out << '\n';
+}
+
+// -------------------
+// printEncodeCommands
+// -------------------
+/*
+ *
+ */
+void ScriptHandler::printEncodeCommands(const TrackJob& job, bool parallel) const
+{
+  // leave the job function on failure
+  const string check = parallel ? " || return 1" : "";
+
+  // create flac command
+  m_out << (job.singlePass ? "  # convert wav to flac and set comments" : "  # convert wav to flac") << '\n';
+  m_out << "  flac --force \\" << '\n';
+  if (parallel)
+  {
+    // don't interleave the progress output of several encoders
+    m_out << "       --silent \\" << '\n';
+  }
+  m_out << "       --verify \\" << '\n';
+  m_out << "       --compression-level-8 \\" << '\n';
+  if ( !job.image.empty() )
+  {
+    m_out << "       --picture=\"3||||" << quote(job.image, false) << "\" \\" << '\n';
+  }
+  if (job.singlePass)
+  {
+    for(unsigned n = 0; n < job.keys.size(); n++)
+    {
+      m_out << "       --tag=\"" << keyinfo::name(job.keys[n]) << "=" << quote(job.values[n], false) << "\" \\" << '\n';
+    }
   }
-  m_fcbuffer << "       --output-name=" << quote(outfile) << " \\" << endl;
-  m_fcbuffer << "       " << quote(infile) << endl;
-  m_fcbuffer << endl;
+  m_out << "       --output-name=" << quote(job.target) << " \\" << '\n';
+  m_out << "       " << quote(job.infile) << check << '\n';
+  m_out << '\n';
 
-  // call metaflac once
-  bool first = true;
+  // flac did it all
+  if (job.singlePass) return;
 
   // create metaflac command
-  for(unsigned n = 0; n < order.size(); n++)
+  for(unsigned n = 0; n < job.keys.size(); n++)
   {
-    // get related value
-    string val = getValue( order[n] );
+    if (n == 0)
+    {
+      // print comment
+      m_out << "  # set comments" << '\n';
+
+      // call metaflac
+      m_out << "  metaflac ";
+    }
 
-    // don't set empty comments
-    if ( !val.empty() )
+    else
     {
-      if (first)
-      {
-        // print comment
-        m_fcbuffer << "  # set comments" << endl;
+      // print indent
+      m_out << "           ";
+    }
+
+    // print next option
+    m_out << "--set-tag=\"" << keyinfo::name(job.keys[n]) << "=" << quote(job.values[n], false) << "\" \\" << '\n';
+  }
+
+  // add filename
+  if ( !job.keys.empty() )
+  {
+    m_out <<  "           " << quote(job.outfile) << check << '\n';
+    m_out << '\n';
+  }
+
+  // create mv command
+  if ( !job.filename.empty() )
+  {
+    m_out << "  # rename file" << '\n';
+    m_out << "  mv -f " << quote(job.outfile) << " " << quote(job.filename) << check << '\n';
+    m_out << '\n';
+  }
+}
+
+// ---------------------
+// printParallelCommands
+// ---------------------
+/*
+ *
+ */
+void ScriptHandler::printParallelCommands() const
+{
+  m_out << "# --------" << '\n';
+  m_out << "# startjob" << '\n';
+  m_out << "# --------" << '\n';
+  m_out << "#" << '\n';
+  m_out << "# This function runs a job in the background as soon as less than" << '\n';
+  m_out << "# $JOBS jobs are running." << '\n';
+  m_out << "#" << '\n';
+  m_out << "# $1  name of the job" << '\n';
+  m_out << "# $2  name of the wav file" << '\n';
+  m_out << "#" << '\n';
+  m_out << "function startjob()" << '\n';
+  m_out << "{" << '\n';
+  m_out << "  # wait for a free slot" << '\n';
+  m_out << "  while (( $(jobs -pr | wc -l) >= JOBS )) ; do" << '\n';
+  m_out << "    wait -n" << '\n';
+  m_out << "  done" << '\n';
+  m_out << '\n';
+  m_out << "  # run job" << '\n';
+  m_out << "  (" << '\n';
+  m_out << "    \"$1\"" << '\n';
+  m_out << "    STATUS=$?" << '\n';
+  m_out << '\n';
+  m_out << "    # job finished" << '\n';
+  m_out << "    if (( STATUS == 0 )) ; then" << '\n';
+  m_out << "      infomsg \"finished: $2\"" << '\n';
+  m_out << '\n';
+  m_out << "    # job failed (2 means skipped)" << '\n';
+  m_out << "    elif (( STATUS != 2 )) ; then" << '\n';
+  m_out << "      failmsg \"failed: $2\"" << '\n';
+  m_out << "      touch \"$STATUSDIR/$1\"" << '\n';
+  m_out << "    fi" << '\n';
+  m_out << "  ) &" << '\n';
+  m_out << "}" << '\n';
+  m_out << '\n';
+
+  // names of the job functions
+  vector<string> names;
+
+  // print one function per job
+  for(unsigned i = 0; i < m_jobs.size(); i++)
+  {
+    // get job
+    const TrackJob& job = m_jobs[i];
+
+    // compile name
+    stringstream strstr;
+    strstr << "job" << setw(3) << setfill('0') << (i + 1);
+    names.push_back( strstr.str() );
+
+    // the line of dashes above and below the name
+    string dashes(names[i].size(), '-');
+
+    m_out << "# " << dashes << '\n';
+    m_out << "# " << names[i] << '\n';
+    m_out << "# " << dashes << '\n';
+    m_out << "#" << '\n';
+    m_out << "# This function encodes " << quote(job.infile, false) << "." << '\n';
+    m_out << "#" << '\n';
+    m_out << "function " << names[i] << "()" << '\n';
+    m_out << "{" << '\n';
+
+    // check wav file
+    m_out << "  # missing or empty wav file" << '\n';
+    m_out << "  if [ ! -s " << quote(job.infile) << " ] ; then" << '\n';
+    m_out << '\n';
+    m_out << "    # notify user" << '\n';
+    m_out << "    warnmsg \"skipping missing (or empty) wav file: " << quote(job.infile, false) << "\"" << '\n';
+    m_out << '\n';
+
+    if ( !job.filename.empty() )
+    {
+      m_out << "    # remove (touched resp. truncated) flac file" << '\n';
+      m_out << "    rm -f " << quote(job.filename) << '\n';
+      m_out << '\n';
+    }
+
+    m_out << "    # signalize skipped job" << '\n';
+    m_out << "    return 2" << '\n';
+    m_out << '\n';
+    m_out << "  fi" << '\n';
+    m_out << '\n';
+
+    m_out << "  # show progress" << '\n';
+    m_out << "  infomsg \"converting " << quote(job.infile, false) << "\"" << '\n';
+    m_out << '\n';
+
+    // convert wav to flac
+    printEncodeCommands(job, true);
+
+    m_out << "  # signalize success" << '\n';
+    m_out << "  return 0" << '\n';
+    m_out << "}" << '\n';
+    m_out << '\n';
+  }
+
+  m_out << "# run up to $JOBS jobs at once (default: number of processors)" << '\n';
+  m_out << "JOBS=\"${JOBS:-$(nproc)}\"" << '\n';
+  m_out << '\n';
+  m_out << "# failed jobs leave a file in this directory" << '\n';
+  m_out << "STATUSDIR=$(mktemp -d)" << '\n';
+  m_out << "trap 'rm -rf \"$STATUSDIR\"' EXIT" << '\n';
+  m_out << '\n';
+
+  // start jobs
+  if ( !m_jobs.empty() )
+  {
+    m_out << "# start jobs" << '\n';
+
+    for(unsigned i = 0; i < m_jobs.size(); i++)
+    {
+      m_out << "startjob " << names[i] << " " << quote(m_jobs[i].infile) << '\n';
+    }
+
+    m_out << '\n';
+  }
+
+  m_out << "# wait for the remaining jobs" << '\n';
+  m_out << "wait" << '\n';
+  m_out << '\n';
+  m_out << "# count failed jobs" << '\n';
+  m_out << "FAILED=$(find \"$STATUSDIR\" -type f | wc -l)" << '\n';
+  m_out << '\n';
+  m_out << "# check failed jobs" << '\n';
+  m_out << "if (( FAILED > 0 )) ; then" << '\n';
+  m_out << '\n';
+  m_out << "  # notify user" << '\n';
+  m_out << "  failmsg \"number of failed jobs: $FAILED\"" << '\n';
+  m_out << '\n';
+  m_out << "  # signalize trouble" << '\n';
+  m_out << "  exit 1" << '\n';
+  m_out << '\n';
+  m_out << "fi" << '\n';
+  m_out << '\n';
+}
+
+// --------
+// makeName
+// --------
+/*
+ *
+ */
+bool ScriptHandler::makeName(const string& name, string& escaped, bool target) const
+{
+  // start with empty name
+  escaped = "";
+
+  // copy characters
+  for(string::size_type i = 0; i < name.size(); i++)
+  {
+    // get current character
+    const char& c = name[i];
+
+    // these characters can't be escaped in target names
+    if ( (c == '|') || (c == ';') || (c == '=') || (c == '\\')
+    ||   (c == '\t') || (c == '\n') || (c == '\r') )
+    {
+      // notify user
+      msg::err( msg::catq("unable to use filename in a makefile: ", name) );
+
+      // signalize trouble
+      return false;
+    }
+
+    // these characters have to be escaped (% only in targets)
+    if ( (c == ' ') || (c == '#') || (c == ':') || ((c == '%') && target) )
+    {
+      escaped += '\\';
+      escaped += c;
+    }
+
+    // variable reference
+    else if (c == '$')
+    {
+      escaped += "$$";
+    }
+
+    // characters without special meaning
+    else
+    {
+      escaped += c;
+    }
+  }
+
+  // signalize success
+  return true;
+}
+
+// ---------
+// makeQuote
+// ---------
+/*
+ * quote() for recipes (inside double quotes)
+ */
+string ScriptHandler::makeQuote(const string& line, bool outer) const
+{
+  // get quoted version
+  string quoted = quote(line, outer);
+
+  // start with empty recipe text
+  string recipe("");
+
+  // copy characters
+  for(string::size_type i = 0; i < quoted.size(); i++)
+  {
+    // get current character
+    const char& c = quoted[i];
+
+    // variable reference
+    if (c == '$')
+    {
+      recipe += "$$";
+    }
+
+    // a newline would end the recipe line
+    else if (c == '\n')
+    {
+      recipe += "\"$$'\\n'\"";
+    }
+
+    // characters without special meaning
+    else
+    {
+      recipe += c;
+    }
+  }
+
+  // return recipe text
+  return recipe;
+}
+
+// -------------
+// printMakefile
+// -------------
+/*
+ *
+ */
+bool ScriptHandler::printMakefile() const
+{
+  // the escaped names of all flac files (as targets and as prerequisites)
+  vector<string> targets;
+  vector<string> prerequisites;
 
-        // call metaflac
-        m_fcbuffer << "  metaflac ";
+  // escape all names first (print nothing in case of trouble)
+  for(unsigned i = 0; i < m_jobs.size(); i++)
+  {
+    // get job
+    const TrackJob& job = m_jobs[i];
+
+    // the escaped names
+    string target;
+    string prerequisite;
+    string image;
+
+    // check names
+    if ( !makeName(job.destination, target, true) ) return false;
+    if ( !makeName(job.destination, prerequisite) ) return false;
+    if ( !makeName(job.image,       image)        ) return false;
+
+    // append names
+    targets.push_back(target);
+    prerequisites.push_back(prerequisite);
+  }
+
+  m_out << "# ------------------------------------------------------------------------------" << '\n';
+  m_out << "# settings                                                              settings" << '\n';
+  m_out << "# ------------------------------------------------------------------------------" << '\n';
+  m_out << '\n';
+  m_out << "# the recipes use bash" << '\n';
+  m_out << "SHELL := /bin/bash" << '\n';
+  m_out << '\n';
+  m_out << "# this directory keeps a digest of the comments of each track" << '\n';
+  m_out << "TAGDIR := .ripgen" << '\n';
+  m_out << '\n';
+  m_out << "# ------------------------------------------------------------------------------" << '\n';
+  m_out << "# targets                                                                targets" << '\n';
+  m_out << "# ------------------------------------------------------------------------------" << '\n';
+  m_out << '\n';
+  m_out << "# create all flac files" << '\n';
+  m_out << "all:";
+  for(unsigned i = 0; i < prerequisites.size(); i++)
+  {
+    m_out << " \\" << '\n' << "     " << prerequisites[i];
+  }
+  m_out << '\n';
+  m_out << '\n';
+  m_out << "# these targets aren't files" << '\n';
+  m_out << ".PHONY: all FORCE" << '\n';
+  m_out << '\n';
+  m_out << "# remove flac files of failed recipes" << '\n';
+  m_out << ".DELETE_ON_ERROR:" << '\n';
+  m_out << '\n';
+
+  // print rules of each track
+  for(unsigned i = 0; i < m_jobs.size(); i++)
+  {
+    // get job
+    const TrackJob& job = m_jobs[i];
+
+    // the name of the tag file
+    const string tagfile = "$(TAGDIR)/" + job.infile + ".tags";
+
+    // the digest of the comments
+    const string digest = job.digest();
+
+    // the escaped name of the image
+    string image;
+    makeName(job.image, image);
+
+    m_out << "# ------------------------------------------------------------------------------" << '\n';
+    m_out << "# " << job.infile << '\n';
+    m_out << "# ------------------------------------------------------------------------------" << '\n';
+    m_out << '\n';
+
+    // the tag file is only touched if the comments have changed
+    m_out << "# update the digest of the comments (if changed)" << '\n';
+    m_out << tagfile << ": FORCE" << '\n';
+    m_out << "\t" << "@mkdir --parents \"$(TAGDIR)\"" << '\n';
+    m_out << "\t" << "@[ \"$$(cat \"$@\" 2>/dev/null)\" == '" << digest << "' ] || echo '" << digest << "' >\"$@\"" << '\n';
+    m_out << '\n';
+
+    // create the flac file
+    m_out << "# create flac file" << '\n';
+    m_out << targets[i] << ": " << job.infile;
+    if ( !image.empty() ) m_out << " " << image;
+    m_out << " " << tagfile << '\n';
+
+    // create target directory
+    if ( !dirname(job.filename).empty() )
+    {
+      m_out << "\t" << "mkdir --parents " << makeQuote( dirname(job.filename) ) << '\n';
+    }
 
-        // update flac
-        first = false;
+    // create flac command
+    m_out << "\t" << "flac --force \\" << '\n';
+    m_out << "\t" << "     --silent \\" << '\n';
+    m_out << "\t" << "     --verify \\" << '\n';
+    m_out << "\t" << "     --compression-level-8 \\" << '\n';
+    if ( !job.image.empty() )
+    {
+      m_out << "\t" << "     --picture=\"3||||" << makeQuote(job.image, false) << "\" \\" << '\n';
+    }
+    if (job.singlePass)
+    {
+      for(unsigned n = 0; n < job.keys.size(); n++)
+      {
+        m_out << "\t" << "     --tag=\"" << keyinfo::name(job.keys[n]) << "=" << makeQuote(job.values[n], false) << "\" \\" << '\n';
       }
+    }
+    m_out << "\t" << "     --output-name=" << makeQuote(job.target) << " \\" << '\n';
+    m_out << "\t" << "     " << makeQuote(job.infile) << '\n';
 
-      else
+    // flac did it all
+    if ( !job.singlePass )
+    {
+      // create metaflac command
+      for(unsigned n = 0; n < job.keys.size(); n++)
       {
-        // print indent
-        m_fcbuffer << "           ";
+        m_out << "\t" << ((n == 0) ? "metaflac " : "         ");
+        m_out << "--set-tag=\"" << keyinfo::name(job.keys[n]) << "=" << makeQuote(job.values[n], false) << "\" \\" << '\n';
       }
 
-      // print next option
-      m_fcbuffer << "--set-tag=\"" << order[n] << "=" << quote(val, false) << "\" \\" << endl;
+      // add filename
+      if ( !job.keys.empty() )
+      {
+        m_out << "\t" << "         " << makeQuote(job.outfile) << '\n';
+      }
+
+      // create mv command
+      if ( !job.filename.empty() )
+      {
+        m_out << "\t" << "mv -f " << makeQuote(job.outfile) << " " << makeQuote(job.filename) << '\n';
+      }
     }
+
+    m_out << '\n';
   }
 
-  // add filename
-  if (!first)
+  // signalize success
+  return true;
+}
+
+// ------------------
+// beginCompactScript
+// ------------------
+/*
+ *
+ */
+void ScriptHandler::beginCompactScript() const
+{
+  // print initial bash code
+  beginScript();
+
+  m_out << "# ------------" << '\n';
+  m_out << "# encode_track" << '\n';
+  m_out << "# ------------" << '\n';
+  m_out << "#" << '\n';
+  m_out << "# This function creates the flac file of one track." << '\n';
+  m_out << "#" << '\n';
+  m_out << "# $1  name of the wav file" << '\n';
+  m_out << "# $2  name of the flac file" << '\n';
+  m_out << "# $3  final name of the flac file (may be empty)" << '\n';
+  m_out << "# $4  name of the image (may be empty)" << '\n';
+  m_out << "# $5  first comment (KEY=value), and so on" << '\n';
+  m_out << "#" << '\n';
+  m_out << "function encode_track()" << '\n';
+  m_out << "{" << '\n';
+  m_out << "  # get parameters" << '\n';
+  m_out << "  local INFILE=\"$1\"" << '\n';
+  m_out << "  local OUTFILE=\"$2\"" << '\n';
+  m_out << "  local FILENAME=\"$3\"" << '\n';
+  m_out << "  local IMAGE=\"$4\"" << '\n';
+  m_out << "  shift 4" << '\n';
+  m_out << '\n';
+  m_out << "  # add empty line" << '\n';
+  m_out << "  echo" << '\n';
+  m_out << '\n';
+  m_out << "  # missing or empty wav file" << '\n';
+  m_out << "  if [ ! -s \"$INFILE\" ] ; then" << '\n';
+  m_out << '\n';
+  m_out << "    # notify user" << '\n';
+  m_out << "    warnmsg \"skipping missing (or empty) wav file: $INFILE\"" << '\n';
+  m_out << '\n';
+  m_out << "    # remove (touched resp. truncated) flac file" << '\n';
+  m_out << "    if [ -n \"$FILENAME\" ] ; then" << '\n';
+  m_out << "      rm -f \"$FILENAME\"" << '\n';
+  m_out << "    fi" << '\n';
+  m_out << '\n';
+  m_out << "    # next track" << '\n';
+  m_out << "    return 0" << '\n';
+  m_out << '\n';
+  m_out << "  fi" << '\n';
+  m_out << '\n';
+  m_out << "  # show progress" << '\n';
+  m_out << "  infomsg \"converting $INFILE\"" << '\n';
+  m_out << '\n';
+  m_out << "  # the cover image" << '\n';
+  m_out << "  local PICTURE=()" << '\n';
+  m_out << "  if [ -n \"$IMAGE\" ] ; then" << '\n';
+  m_out << "    PICTURE=( \"--picture=3||||$IMAGE\" )" << '\n';
+  m_out << "  fi" << '\n';
+  m_out << '\n';
+
+  // let flac do it all
+  if (m_singlePass)
   {
-    m_fcbuffer <<  "           " << quote(outfile) << endl;
+    m_out << "  # the comments" << '\n';
+    m_out << "  local TAGS=()" << '\n';
+    m_out << "  for TAG in \"$@\" ; do" << '\n';
+    m_out << "    TAGS+=( \"--tag=$TAG\" )" << '\n';
+    m_out << "  done" << '\n';
+    m_out << '\n';
+    m_out << "  # convert wav to flac and set comments" << '\n';
+    m_out << "  flac --force \\" << '\n';
+    m_out << "       --verify \\" << '\n';
+    m_out << "       --compression-level-8 \\" << '\n';
+    m_out << "       \"${PICTURE[@]}\" \\" << '\n';
+    m_out << "       \"${TAGS[@]}\" \\" << '\n';
+    m_out << "       --output-name=\"${FILENAME:-$OUTFILE}\" \\" << '\n';
+    m_out << "       \"$INFILE\"" << '\n';
   }
 
-  m_fcbuffer << endl;
-
-  // create mv command
-  if ( !filename.empty() )
+  // flac, metaflac and mv
+  else
   {
-    // add checks
-    m_dchecks.insert( dirname(filename) );
-    m_fchecks.insert( filename );
+    m_out << "  # the comments" << '\n';
+    m_out << "  local TAGS=()" << '\n';
+    m_out << "  for TAG in \"$@\" ; do" << '\n';
+    m_out << "    TAGS+=( \"--set-tag=$TAG\" )" << '\n';
+    m_out << "  done" << '\n';
+    m_out << '\n';
+    m_out << "  # convert wav to flac" << '\n';
+    m_out << "  flac --force \\" << '\n';
+    m_out << "       --verify \\" << '\n';
+    m_out << "       --compression-level-8 \\" << '\n';
+    m_out << "       \"${PICTURE[@]}\" \\" << '\n';
+    m_out << "       --output-name=\"$OUTFILE\" \\" << '\n';
+    m_out << "       \"$INFILE\"" << '\n';
+    m_out << '\n';
+    m_out << "  # set comments" << '\n';
+    m_out << "  if (( ${#TAGS[@]} > 0 )) ; then" << '\n';
+    m_out << "    metaflac \"${TAGS[@]}\" \"$OUTFILE\"" << '\n';
+    m_out << "  fi" << '\n';
+    m_out << '\n';
+    m_out << "  # rename file" << '\n';
+    m_out << "  if [ -n \"$FILENAME\" ] ; then" << '\n';
+    m_out << "    mv -f \"$OUTFILE\" \"$FILENAME\"" << '\n';
+    m_out << "  fi" << '\n';
+  }
+
+  m_out << "}" << '\n';
+  m_out << '\n';
+
+  m_out << "# ----------" << '\n';
+  m_out << "# encode_all" << '\n';
+  m_out << "# ----------" << '\n';
+  m_out << "#" << '\n';
+  m_out << "# This function encodes all tracks (one row per track)." << '\n';
+  m_out << "#" << '\n';
+  m_out << "function encode_all()" << '\n';
+  m_out << "{" << '\n';
+}
 
-    m_fcbuffer << "  # rename file" << endl;
-    m_fcbuffer << "  mv -f " << quote(outfile) << " " << quote(filename) << endl;
-    m_fcbuffer << endl;
+// ---------------
+// printCompactRow
+// ---------------
+/*
+ *
+ */
+void ScriptHandler::printCompactRow(const TrackJob& job) const
+{
+  // file names
+  m_out << "  encode_track " << quote(job.infile)
+        << " " << quote(job.outfile)
+        << " " << quote(job.filename)
+        << " " << quote(job.image);
+
+  // comments
+  for(unsigned n = 0; n < job.keys.size(); n++)
+  {
+    m_out << " " << quote(keyinfo::name(job.keys[n]) + "=" + job.values[n]);
   }
 
-  // start else block
-  m_fcbuffer << "# missing or empty wav file" << endl;
-  m_fcbuffer << "else" << endl;
-  m_fcbuffer << endl;
-  m_fcbuffer << "  # notify user" << endl;
-  m_fcbuffer << "  warnmsg \"skipping missing (or empty) wav file: " << quote(infile, false) << "\"" << endl;
-  m_fcbuffer << endl;
-
-  if ( !filename.empty() )
+  m_out << '\n';
+}
+
+// -----------------
+// dropCompactScript
+// -----------------
+/*
+ * stdout is flushed after each file, a worker thread has a string per file
+ */
+void ScriptHandler::dropCompactScript() const
+{
+  // buffered stdout
+  OutputSink* sink = dynamic_cast<OutputSink*>( m_out.rdbuf() );
+  if ( (sink != 0) && sink->discard() ) return;
+
+  // buffered string
+  stringbuf* buffer = dynamic_cast<stringbuf*>( m_out.rdbuf() );
+  if ( (buffer != 0) && (m_start >= 0) )
   {
-    m_fcbuffer << "  # remove (touched resp. truncated) flac file" << endl;
-    m_fcbuffer << "  rm -f " << quote(filename) << endl;
-    m_fcbuffer << endl;
+    // cut off script
+    buffer->str( buffer->str().substr(0, m_start) );
+    m_out.seekp(0, ios::end);
+
+    // signalize success
+    return;
   }
 
-  m_fcbuffer << "fi" << endl;
-  m_fcbuffer << endl;
+  // close encode_all() (part of the rows has been written already)
+  m_out << "  # broken file" << '\n';
+  m_out << "  return 1" << '\n';
+  m_out << "}" << '\n';
+  m_out << '\n';
+  m_out << "# don't encode anything" << '\n';
+  m_out << "failmsg \"broken file\"" << '\n';
+  m_out << "exit 1" << '\n';
 }
 
 // -----------
@@ -411,226 +1012,226 @@ void ScriptHandler::bufferFileCommands()
  */
 void ScriptHandler::beginScript() const
 {
-  cout << "#!/bin/bash" << endl;
-  cout << endl;
-  cout << "# ------------------------------------------------------------------------------" << endl;
-  cout << "# settings                                                              settings" << endl;
-  cout << "# ------------------------------------------------------------------------------" << endl;
-  cout << endl;
-  cout << "# terminal colors" << endl;
-  cout << "   NONE=$(tput sgr0)" << endl;
-  cout << "    RED=$(tput setaf 1)" << endl;
-  cout << "  GREEN=$(tput setaf 2)" << endl;
-  cout << " YELLOW=$(tput setaf 3)" << endl;
-  cout << "   BLUE=$(tput setaf 4)" << endl;
-  cout << "MAGENTA=$(tput setaf 5)" << endl;
-  cout << "   CYAN=$(tput setaf 6)" << endl;
-  cout << "  WHITE=$(tput setaf 7)" << endl;
-  cout << endl;
-  cout << "# ------------------------------------------------------------------------------" << endl;
-  cout << "# functions                                                            functions" << endl;
-  cout << "# ------------------------------------------------------------------------------" << endl;
-  cout << endl;
-
-  cout << "# -------" << endl;
-  cout << "# failmsg" << endl;
-  cout << "# -------" << endl;
-  cout << "#" << endl;
-  cout << "# This function prints a fail message via stderr." << endl;
-  cout << "#" << endl;
-  cout << "function failmsg()" << endl;
-  cout << "{" << endl;
-  cout << "  # push to stderr" << endl;
-  cout << "  echo -e \"${RED}[FAIL]${NONE} $1\" 1>&2" << endl;
-  cout << "}" << endl;
-  cout << endl;
-  cout << "# -------" << endl;
-  cout << "# warnmsg" << endl;
-  cout << "# -------" << endl;
-  cout << "#" << endl;
-  cout << "# This function prints a warn message via stderr." << endl;
-  cout << "#" << endl;
-  cout << "function warnmsg()" << endl;
-  cout << "{" << endl;
-  cout << "  # push to stderr" << endl;
-  cout << "  echo -e \"${YELLOW}[WARN]${NONE} $1\" 1>&2" << endl;
-  cout << "}" << endl;
-  cout << endl;
-  cout << "# -------" << endl;
-  cout << "# infomsg" << endl;
-  cout << "# -------" << endl;
-  cout << "#" << endl;
-  cout << "# This function prints an info message via stderr." << endl;
-  cout << "#" << endl;
-  cout << "function infomsg()" << endl;
-  cout << "{" << endl;
-  cout << "  # push to stderr" << endl;
-  cout << "  echo -e \"${BLUE}[INFO]${NONE} $1\" 1>&2" << endl;
-  cout << "}" << endl;
-  cout << endl;
-
-  cout << "# -------" << endl;
-  cout << "# chktool" << endl;
-  cout << "# -------" << endl;
-  cout << "#" << endl;
-  cout << "# This function checks if an external tool is installed." << endl;
-  cout << "#" << endl;
-  cout << "# $1  name of the tool to check" << endl;
-  cout << "#" << endl;
-  cout << "function chktool()" << endl;
-  cout << "{" << endl;
-  cout << "  # query type" << endl;
-  cout << "  TOOLTYPE=$(type -t \"$1\")" << endl;
-  cout << endl;
-  cout << "  # check type" << endl;
-  cout << "  if [ \"$TOOLTYPE\" != 'file' ] ; then" << endl;
-  cout << endl;
-  cout << "    # notify user" << endl;
-  cout << "    failmsg \"external tool is missing: \\\"$1\\\"\"" << endl;
-  cout << endl;
-  cout << "    # signalize trouble" << endl;
-  cout << "    exit 1" << endl;
-  cout << endl;
-  cout << "  fi" << endl;
-  cout << "}" << endl;
-  cout << endl;
-  cout << "# --------" << endl;
-  cout << "# chkimage" << endl;
-  cout << "# --------" << endl;
-  cout << "#" << endl;
-  cout << "# This function checks type, size and dimension of the cover image." << endl;
-  cout << "#" << endl;
-  cout << "# $1  filename" << endl;
-  cout << "#" << endl;
-  cout << "function chkimage()" << endl;
-  cout << "{" << endl;
-  cout << "  # check if the image exists" << endl;
-  cout << "  if [ ! -f \"$1\" ] ; then" << endl;
-  cout << endl;
-  cout << "    # notify user" << endl;
-  cout << "    failmsg \"unable to locate file: \\\"$1\\\"\"" << endl;
-  cout << endl;
-  cout << "    # signalize trouble" << endl;
-  cout << "    exit 1" << endl;
-  cout << endl;
-  cout << "  fi" << endl;
-  cout << endl;
-  cout << "  # get file size in byte" << endl;
-  cout << "  FILESIZE=$(stat --printf '%s' \"$1\")" << endl;
-  cout << endl;
-  cout << "  # get image format" << endl;
-  cout << "  FORMAT=$(identify -format '%m' \"$1\")" << endl;
-  cout << endl;
-  cout << "  # jpeg found" << endl;
-  cout << "  if [ \"$FORMAT\" == 'JPEG' ] ; then" << endl;
-  cout << endl;
-  cout << "    # check file size" << endl;
-  cout << "    if (( FILESIZE > 85000 )) ; then" << endl;
-  cout << endl;
-  cout << "      # notify user" << endl;
-  cout << "      failmsg \"the image's file size should not exeed 80K (found: $FILESIZE)\"" << endl;
-  cout << endl;
-  cout << "      # signalize trouble" << endl;
-  cout << "      exit 1" << endl;
-  cout << endl;
-  cout << "    fi" << endl;
-  cout << endl;
-  cout << "  # png found" << endl;
-  cout << "  elif [ \"$FORMAT\" == 'PNG' ] ; then" << endl;
-  cout << endl;
-  cout << "    # check file size" << endl;
-  cout << "    if (( FILESIZE > 505000 )) ; then" << endl;
-  cout << endl;
-  cout << "      # notify user" << endl;
-  cout << "      failmsg \"the image's file size should not exeed 500K (found: $FILESIZE)\"" << endl;
-  cout << endl;
-  cout << "      # signalize trouble" << endl;
-  cout << "      exit 1" << endl;
-  cout << endl;
-  cout << "    fi" << endl;
-  cout << endl;
-  cout << "  # other image types" << endl;
-  cout << "  else" << endl;
-  cout << endl;
-  cout << "    # notify user" << endl;
-  cout << "    failmsg \"the image must have either JPEG or PNG format (found: $FORMAT)\"" << endl;
-  cout << endl;
-  cout << "    # signalize trouble" << endl;
-  cout << "    exit 1" << endl;
-  cout << endl;
-  cout << "  fi" << endl;
-  cout << endl;
-  cout << "  # get image dimensions" << endl;
-  cout << "  DIMENSIONS=$(identify -format '%wx%h' \"$1\")" << endl;
-  cout << endl;
-  cout << "  # check dimensions" << endl;
-  cout << "  if [ \"$DIMENSIONS\" != '300x300' ] ; then" << endl;
-  cout << endl;
-  cout << "    # notify user" << endl;
-  cout << "    failmsg \"the image must must be 300px wide and 300px high (found: $DIMENSIONS)\"" << endl;
-  cout << endl;
-  cout << "    # signalize trouble" << endl;
-  cout << "    exit 1" << endl;
-  cout << endl;
-  cout << "  fi" << endl;
-  cout << "}" << endl;
-  cout << endl;
-  cout << "# -------" << endl;
-  cout << "# chktdir" << endl;
-  cout << "# -------" << endl;
-  cout << "#" << endl;
-  cout << "# This function checks if the target directory can be created." << endl;
-  cout << "#" << endl;
-  cout << "# $1  name of the directory" << endl;
-  cout << "#" << endl;
-  cout << "function chktdir()" << endl;
-  cout << "{" << endl;
-  cout << "  # try to create directory" << endl;
-  cout << "  mkdir --parents \"$1\" &>'/dev/null'" << endl;
-  cout << endl;
-  cout << "  # check if directory exists" << endl;
-  cout << "  if [ ! -d \"$1\" ] ; then" << endl;
-  cout << endl;
-  cout << "    # notify user" << endl;
-  cout << "    failmsg \"unable to create target directory: \\\"$1\\\"\"" << endl;
-  cout << endl;
-  cout << "    # signalize trouble" << endl;
-  cout << "    exit 1" << endl;
-  cout << endl;
-  cout << "  fi" << endl;
-  cout << "}" << endl;
-  cout << endl;
-  cout << "# --------" << endl;
-  cout << "# chktfile" << endl;
-  cout << "# --------" << endl;
-  cout << "#" << endl;
-  cout << "# This function checks if the target file can be created." << endl;
-  cout << "#" << endl;
-  cout << "# $1  filename" << endl;
-  cout << "#" << endl;
-  cout << "function chktfile()" << endl;
-  cout << "{" << endl;
-  cout << "  # try to truncate (resp. create) file" << endl;
-  cout << "  if ! truncate --size='0' \"$1\" &>'/dev/null' ; then" << endl;
-  cout << endl;
-  cout << "    # notify user" << endl;
-  cout << "    failmsg \"unable to create target file: \\\"$1\\\"\"" << endl;
-  cout << endl;
-  cout << "    # signalize trouble" << endl;
-  cout << "    exit 1" << endl;
-  cout << endl;
-  cout << "  fi" << endl;
-  cout << "}" << endl;
-  cout << endl;
-  cout << "# ------------------------------------------------------------------------------" << endl;
-  cout << "# commands                                                              commands" << endl;
-  cout << "# ------------------------------------------------------------------------------" << endl;
-  cout << endl;
-  cout << "# check required tools" << endl;
-  cout << "chktool 'flac'" << endl;
-  cout << "chktool 'metaflac'" << endl;
-  cout << "chktool 'identify'" << endl;
-  cout << endl;
+  m_out << "#!/bin/bash" << '\n';
+  m_out << '\n';
+  m_out << "# ------------------------------------------------------------------------------" << '\n';
+  m_out << "# settings                                                              settings" << '\n';
+  m_out << "# ------------------------------------------------------------------------------" << '\n';
+  m_out << '\n';
+  m_out << "# terminal colors" << '\n';
+  m_out << "   NONE=$(tput sgr0)" << '\n';
+  m_out << "    RED=$(tput setaf 1)" << '\n';
+  m_out << "  GREEN=$(tput setaf 2)" << '\n';
+  m_out << " YELLOW=$(tput setaf 3)" << '\n';
+  m_out << "   BLUE=$(tput setaf 4)" << '\n';
+  m_out << "MAGENTA=$(tput setaf 5)" << '\n';
+  m_out << "   CYAN=$(tput setaf 6)" << '\n';
+  m_out << "  WHITE=$(tput setaf 7)" << '\n';
+  m_out << '\n';
+  m_out << "# ------------------------------------------------------------------------------" << '\n';
+  m_out << "# functions                                                            functions" << '\n';
+  m_out << "# ------------------------------------------------------------------------------" << '\n';
+  m_out << '\n';
+
+  m_out << "# -------" << '\n';
+  m_out << "# failmsg" << '\n';
+  m_out << "# -------" << '\n';
+  m_out << "#" << '\n';
+  m_out << "# This function prints a fail message via stderr." << '\n';
+  m_out << "#" << '\n';
+  m_out << "function failmsg()" << '\n';
+  m_out << "{" << '\n';
+  m_out << "  # push to stderr" << '\n';
+  m_out << "  echo -e \"${RED}[FAIL]${NONE} $1\" 1>&2" << '\n';
+  m_out << "}" << '\n';
+  m_out << '\n';
+  m_out << "# -------" << '\n';
+  m_out << "# warnmsg" << '\n';
+  m_out << "# -------" << '\n';
+  m_out << "#" << '\n';
+  m_out << "# This function prints a warn message via stderr." << '\n';
+  m_out << "#" << '\n';
+  m_out << "function warnmsg()" << '\n';
+  m_out << "{" << '\n';
+  m_out << "  # push to stderr" << '\n';
+  m_out << "  echo -e \"${YELLOW}[WARN]${NONE} $1\" 1>&2" << '\n';
+  m_out << "}" << '\n';
+  m_out << '\n';
+  m_out << "# -------" << '\n';
+  m_out << "# infomsg" << '\n';
+  m_out << "# -------" << '\n';
+  m_out << "#" << '\n';
+  m_out << "# This function prints an info message via stderr." << '\n';
+  m_out << "#" << '\n';
+  m_out << "function infomsg()" << '\n';
+  m_out << "{" << '\n';
+  m_out << "  # push to stderr" << '\n';
+  m_out << "  echo -e \"${BLUE}[INFO]${NONE} $1\" 1>&2" << '\n';
+  m_out << "}" << '\n';
+  m_out << '\n';
+
+  m_out << "# -------" << '\n';
+  m_out << "# chktool" << '\n';
+  m_out << "# -------" << '\n';
+  m_out << "#" << '\n';
+  m_out << "# This function checks if an external tool is installed." << '\n';
+  m_out << "#" << '\n';
+  m_out << "# $1  name of the tool to check" << '\n';
+  m_out << "#" << '\n';
+  m_out << "function chktool()" << '\n';
+  m_out << "{" << '\n';
+  m_out << "  # query type" << '\n';
+  m_out << "  TOOLTYPE=$(type -t \"$1\")" << '\n';
+  m_out << '\n';
+  m_out << "  # check type" << '\n';
+  m_out << "  if [ \"$TOOLTYPE\" != 'file' ] ; then" << '\n';
+  m_out << '\n';
+  m_out << "    # notify user" << '\n';
+  m_out << "    failmsg \"external tool is missing: \\\"$1\\\"\"" << '\n';
+  m_out << '\n';
+  m_out << "    # signalize trouble" << '\n';
+  m_out << "    exit 1" << '\n';
+  m_out << '\n';
+  m_out << "  fi" << '\n';
+  m_out << "}" << '\n';
+  m_out << '\n';
+  m_out << "# --------" << '\n';
+  m_out << "# chkimage" << '\n';
+  m_out << "# --------" << '\n';
+  m_out << "#" << '\n';
+  m_out << "# This function checks type, size and dimension of the cover image." << '\n';
+  m_out << "#" << '\n';
+  m_out << "# $1  filename" << '\n';
+  m_out << "#" << '\n';
+  m_out << "function chkimage()" << '\n';
+  m_out << "{" << '\n';
+  m_out << "  # check if the image exists" << '\n';
+  m_out << "  if [ ! -f \"$1\" ] ; then" << '\n';
+  m_out << '\n';
+  m_out << "    # notify user" << '\n';
+  m_out << "    failmsg \"unable to locate file: \\\"$1\\\"\"" << '\n';
+  m_out << '\n';
+  m_out << "    # signalize trouble" << '\n';
+  m_out << "    exit 1" << '\n';
+  m_out << '\n';
+  m_out << "  fi" << '\n';
+  m_out << '\n';
+  m_out << "  # get file size in byte" << '\n';
+  m_out << "  FILESIZE=$(stat --printf '%s' \"$1\")" << '\n';
+  m_out << '\n';
+  m_out << "  # get image format" << '\n';
+  m_out << "  FORMAT=$(identify -format '%m' \"$1\")" << '\n';
+  m_out << '\n';
+  m_out << "  # jpeg found" << '\n';
+  m_out << "  if [ \"$FORMAT\" == 'JPEG' ] ; then" << '\n';
+  m_out << '\n';
+  m_out << "    # check file size" << '\n';
+  m_out << "    if (( FILESIZE > 85000 )) ; then" << '\n';
+  m_out << '\n';
+  m_out << "      # notify user" << '\n';
+  m_out << "      failmsg \"the image's file size should not exeed 80K (found: $FILESIZE)\"" << '\n';
+  m_out << '\n';
+  m_out << "      # signalize trouble" << '\n';
+  m_out << "      exit 1" << '\n';
+  m_out << '\n';
+  m_out << "    fi" << '\n';
+  m_out << '\n';
+  m_out << "  # png found" << '\n';
+  m_out << "  elif [ \"$FORMAT\" == 'PNG' ] ; then" << '\n';
+  m_out << '\n';
+  m_out << "    # check file size" << '\n';
+  m_out << "    if (( FILESIZE > 505000 )) ; then" << '\n';
+  m_out << '\n';
+  m_out << "      # notify user" << '\n';
+  m_out << "      failmsg \"the image's file size should not exeed 500K (found: $FILESIZE)\"" << '\n';
+  m_out << '\n';
+  m_out << "      # signalize trouble" << '\n';
+  m_out << "      exit 1" << '\n';
+  m_out << '\n';
+  m_out << "    fi" << '\n';
+  m_out << '\n';
+  m_out << "  # other image types" << '\n';
+  m_out << "  else" << '\n';
+  m_out << '\n';
+  m_out << "    # notify user" << '\n';
+  m_out << "    failmsg \"the image must have either JPEG or PNG format (found: $FORMAT)\"" << '\n';
+  m_out << '\n';
+  m_out << "    # signalize trouble" << '\n';
+  m_out << "    exit 1" << '\n';
+  m_out << '\n';
+  m_out << "  fi" << '\n';
+  m_out << '\n';
+  m_out << "  # get image dimensions" << '\n';
+  m_out << "  DIMENSIONS=$(identify -format '%wx%h' \"$1\")" << '\n';
+  m_out << '\n';
+  m_out << "  # check dimensions" << '\n';
+  m_out << "  if [ \"$DIMENSIONS\" != '300x300' ] ; then" << '\n';
+  m_out << '\n';
+  m_out << "    # notify user" << '\n';
+  m_out << "    failmsg \"the image must must be 300px wide and 300px high (found: $DIMENSIONS)\"" << '\n';
+  m_out << '\n';
+  m_out << "    # signalize trouble" << '\n';
+  m_out << "    exit 1" << '\n';
+  m_out << '\n';
+  m_out << "  fi" << '\n';
+  m_out << "}" << '\n';
+  m_out << '\n';
+  m_out << "# -------" << '\n';
+  m_out << "# chktdir" << '\n';
+  m_out << "# -------" << '\n';
+  m_out << "#" << '\n';
+  m_out << "# This function checks if the target directory can be created." << '\n';
+  m_out << "#" << '\n';
+  m_out << "# $1  name of the directory" << '\n';
+  m_out << "#" << '\n';
+  m_out << "function chktdir()" << '\n';
+  m_out << "{" << '\n';
+  m_out << "  # try to create directory" << '\n';
+  m_out << "  mkdir --parents \"$1\" &>'/dev/null'" << '\n';
+  m_out << '\n';
+  m_out << "  # check if directory exists" << '\n';
+  m_out << "  if [ ! -d \"$1\" ] ; then" << '\n';
+  m_out << '\n';
+  m_out << "    # notify user" << '\n';
+  m_out << "    failmsg \"unable to create target directory: \\\"$1\\\"\"" << '\n';
+  m_out << '\n';
+  m_out << "    # signalize trouble" << '\n';
+  m_out << "    exit 1" << '\n';
+  m_out << '\n';
+  m_out << "  fi" << '\n';
+  m_out << "}" << '\n';
+  m_out << '\n';
+  m_out << "# --------" << '\n';
+  m_out << "# chktfile" << '\n';
+  m_out << "# --------" << '\n';
+  m_out << "#" << '\n';
+  m_out << "# This function checks if the target file can be created." << '\n';
+  m_out << "#" << '\n';
+  m_out << "# $1  filename" << '\n';
+  m_out << "#" << '\n';
+  m_out << "function chktfile()" << '\n';
+  m_out << "{" << '\n';
+  m_out << "  # try to truncate (resp. create) file" << '\n';
+  m_out << "  if ! truncate --size='0' \"$1\" &>'/dev/null' ; then" << '\n';
+  m_out << '\n';
+  m_out << "    # notify user" << '\n';
+  m_out << "    failmsg \"unable to create target file: \\\"$1\\\"\"" << '\n';
+  m_out << '\n';
+  m_out << "    # signalize trouble" << '\n';
+  m_out << "    exit 1" << '\n';
+  m_out << '\n';
+  m_out << "  fi" << '\n';
+  m_out << "}" << '\n';
+  m_out << '\n';
+  m_out << "# ------------------------------------------------------------------------------" << '\n';
+  m_out << "# commands                                                              commands" << '\n';
+  m_out << "# ------------------------------------------------------------------------------" << '\n';
+  m_out << '\n';
+  m_out << "# check required tools" << '\n';
+  m_out << "chktool 'flac'" << '\n';
+  m_out << "chktool 'metaflac'" << '\n';
+  m_out << "chktool 'identify'" << '\n';
+  m_out << '\n';
 }
 
 // ------------------
@@ -648,48 +1249,48 @@ void ScriptHandler::printCheckCommands() const
   if ( !m_ichecks.empty() )
   {
     // print comment
-    cout << "# check images" << endl;
+    m_out << "# check images" << '\n';
 
     // print all images to check
     for(itt it = m_ichecks.begin(); it != m_ichecks.end(); ++it)
     {
-      cout << "chkimage " << quote(*it) << endl;
+      m_out << "chkimage " << quote(*it) << '\n';
     }
 
     // print empty line
-    cout << endl;
+    m_out << '\n';
   }
 
   // directory checks
   if ( !m_dchecks.empty() )
   {
     // print comment
-    cout << "# check directories" << endl;
+    m_out << "# check directories" << '\n';
 
     // print all directories to check
     for(itt it = m_dchecks.begin(); it != m_dchecks.end(); ++it)
     {
-      cout << "chktdir " << quote(*it) << endl;
+      m_out << "chktdir " << quote(*it) << '\n';
     }
 
     // print empty line
-    cout << endl;
+    m_out << '\n';
   }
 
   // file checks
   if ( !m_fchecks.empty() )
   {
     // print comment
-    cout << "# check files" << endl;
+    m_out << "# check files" << '\n';
 
     // print all files to check
     for(itt it = m_fchecks.begin(); it != m_fchecks.end(); ++it)
     {
-      cout << "chktfile " << quote(*it) << endl;
+      m_out << "chktfile " << quote(*it) << '\n';
     }
 
     // print empty line
-    cout << endl;
+    m_out << '\n';
   }
 }
 
@@ -701,7 +1302,23 @@ void ScriptHandler::printCheckCommands() const
  */
 void ScriptHandler::endScript() const
 {
-  cout << "# signalize success" << endl;
-  cout << "exit 0" << endl;
+  m_out << "# signalize success" << '\n';
+  m_out << "exit 0" << '\n';
+}
+
+// -----
+// reset
+// -----
+/*
+ *
+ */
+void ScriptHandler::reset()
+{
+  m_track.clear();
+  m_ichecks.clear();
+  m_dchecks.clear();
+  m_fchecks.clear();
+  m_jobs.clear();
+  m_rows = 0;
 }
 
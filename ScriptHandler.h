@@ -22,8 +22,10 @@
 #include <set>
 #include <vector>
 #include <string>
-#include <sstream>
+#include <iostream>
 #include "KVHandler.h"
+#include "TrackRecord.h"
+#include "TrackJob.h"
 
 
 // -----------------------------------------------------------------------------
@@ -43,6 +45,20 @@ class ScriptHandler : public KVHandler
 
 public:
 
+  // ---------------------------------------------------------------------------
+  // Settings                                                           Settings
+  // ---------------------------------------------------------------------------
+
+  // options of the script (may be combined)
+  enum
+  {
+    PARALLEL    = 1,  ///< encode several tracks at once
+    SINGLE_PASS = 2,  ///< let flac set the comments and write the final file
+    MAKEFILE    = 4,  ///< print a makefile instead of a bash script
+    COMPACT     = 8   ///< print one row per track (instead of a block)
+  };
+
+
   // ---------------------------------------------------------------------------
   // Construction                                                   Construction
   // ---------------------------------------------------------------------------
@@ -52,8 +68,11 @@ public:
   // -------------
   /**
    * @brief  The standard-constructor.
+   *
+   * @param out      holds the stream that receives the script.
+   * @param options  holds the options of the script (see above).
    */
-  ScriptHandler();
+  ScriptHandler(ostream& out = cout, unsigned options = 0);
 
 
   // ---------------------------------------------------------------------------
@@ -82,7 +101,7 @@ public:
   /**
    *
    */
-  virtual void OnData(const string& key, const string& value);
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
 
 
 protected:
@@ -107,21 +126,108 @@ protected:
    */
   string quote(const string& line, bool outer = true) const;
 
+  // ---------
+  // bufferJob
+  // ---------
+  /**
+   * @brief  This method buffers the job of the current track.
+   */
+  void bufferJob();
+
+  // -----------------
+  // printFileCommands
+  // -----------------
+  /**
+   * @brief  This method prints the commands of one job (one after another).
+   */
+  void printFileCommands(const TrackJob& job) const;
+
+  // -------------------
+  // printEncodeCommands
+  // -------------------
+  /**
+   * @brief  This method prints the commands that create the flac file
+   *         of one job.
+   *
+   * @param parallel  the commands are part of a job function.
+   */
+  void printEncodeCommands(const TrackJob& job, bool parallel) const;
+
+  // ---------------------
+  // printParallelCommands
+  // ---------------------
+  /**
+   * @brief  This method prints the commands of all jobs as functions
+   *         that are run by a bounded pool of background jobs.
+   */
+  void printParallelCommands() const;
+
   // --------
-  // getValue
+  // makeName
   // --------
   /**
+   * @brief  This method escapes a filename for use as target or
+   *         prerequisite of a makefile.
+   *
+   * @param target  the name is used as target (not as prerequisite).
    *
+   * @return  false if make can't handle the filename
+   */
+  bool makeName(const string& name, string& escaped, bool target = false) const;
+
+  // ---------
+  // makeQuote
+  // ---------
+  /**
+   * @brief  This method quotes a line like quote() for use in a recipe.
    */
-  string getValue(const string& key) const;
+  string makeQuote(const string& line, bool outer = true) const;
+
+  // -------------
+  // printMakefile
+  // -------------
+  /**
+   * @brief  This method prints a makefile with one target per flac file.
+   *
+   * Each flac file depends on its wav file, its image and a file that
+   * holds the digest of its comments, so make only recreates the flac
+   * files that are out of date.
+   *
+   * @return  false if a filename can't be used in a makefile
+   */
+  bool printMakefile() const;
 
   // ------------------
-  // bufferFileCommands
+  // beginCompactScript
   // ------------------
   /**
+   * @brief  This method prints the initial bash code of the compact script
+   *         (including the function that encodes one track).
+   *
+   * The rows of all tracks are part of the function encode_all(), which
+   * is called after the checks at the end of the script. A script that
+   * is cut off doesn't encode anything.
+   */
+  void beginCompactScript() const;
+
+  // ---------------
+  // printCompactRow
+  // ---------------
+  /**
+   * @brief  This method prints the row (the call of encode_track) of one job.
+   */
+  void printCompactRow(const TrackJob& job) const;
+
+  // -----------------
+  // dropCompactScript
+  // -----------------
+  /**
+   * @brief  This method removes the rows of a broken file from the output.
    *
+   * The rows are still buffered unless the file is large: in this case,
+   * encode_all() is closed and the script exits with an error instead.
    */
-  void bufferFileCommands();
+  void dropCompactScript() const;
 
   // -----------
   // beginScript
@@ -147,19 +253,19 @@ protected:
    */
   void endScript() const;
 
+  // -----
+  // reset
+  // -----
+  /**
+   * @brief  This method empties all buffers.
+   */
+  void reset();
 
-private:
 
   // ---------------------------------------------------------------------------
   // Attributes                                                       Attributes
   // ---------------------------------------------------------------------------
 
-  /// buffer of keys
-  vector<string> m_keys;
-
-  /// buffer of values
-  vector<string> m_values;
-
   /// images to check
   set<string> m_ichecks;
 
@@ -169,8 +275,39 @@ private:
   /// files to check
   set<string> m_fchecks;
 
-  /// buffer for all file commands
-  stringstream m_fcbuffer;
+  /// the jobs of all tracks
+  vector<TrackJob> m_jobs;
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the stream that receives the script
+  ostream& m_out;
+
+  /// the tags of the current track
+  TrackRecord m_track;
+
+  /// encode several tracks at once
+  bool m_parallel;
+
+  /// let flac set the comments and write the final file
+  bool m_singlePass;
+
+  /// print a makefile instead of a bash script
+  bool m_makefile;
+
+  /// print one row per track (instead of a block)
+  bool m_compact;
+
+  /// the number of rows printed (compact script)
+  unsigned m_rows;
+
+  /// the position of the script in the stream (-1: unknown)
+  streampos m_start;
 };
 
 #endif  /* #ifndef SCRIPTHANDLER_H_INCLUDE_NO1 */
@@ -58,6 +58,7 @@ void StackHandler::OnBeginParsing(const string& filename)
   setHealthy();
 
   // reset stacks
+  m_istack.clear();
   m_kstack.clear();
   m_vstack.clear();
 
@@ -81,6 +82,7 @@ void StackHandler::OnBeginParsing(const string& filename)
 void StackHandler::OnEndParsing(bool healthy)
 {
   // empty stacks
+  m_istack.clear();
   m_kstack.clear();
   m_vstack.clear();
 
@@ -97,7 +99,7 @@ void StackHandler::OnEndParsing(bool healthy)
 /*
  *
  */
-void StackHandler::OnData(const string& key, const string& value)
+void StackHandler::OnData(unsigned keyID, const string& key, const string& value)
 {
   // no handler set
   if (m_next == 0) return;
@@ -106,12 +108,13 @@ void StackHandler::OnData(const string& key, const string& value)
   if ( !healthy() ) return;
 
   // cut stacks
-  for(unsigned i = 0; i < m_kstack.size(); i++)
+  for(unsigned i = 0; i < m_istack.size(); i++)
   {
     // key found
-    if (m_kstack[i] == key)
+    if (m_istack[i] == keyID)
     {
       // cut stacks here
+      m_istack.resize(i);
       m_kstack.resize(i);
       m_vstack.resize(i);
 
@@ -124,7 +127,7 @@ void StackHandler::OnData(const string& key, const string& value)
   if ( value.empty() ) return;
 
   // new track number passed
-  if (key == keyinfo::name(keyinfo::TRACKNUMBER))
+  if (keyID == keyinfo::TRACKNUMBER)
   {
     // convert to unsigned
     if ( str2unsigned(value, m_tracknum) )
@@ -148,58 +151,48 @@ void StackHandler::OnData(const string& key, const string& value)
   }
 
   // new compilation ID passed
-  else if (key == keyinfo::name(keyinfo::COMPILATIONID))
+  else if (keyID == keyinfo::COMPILATIONID)
   {
     // append data
-    m_kstack.push_back(key);
-    m_vstack.push_back(value);
+    push(keyID, key, value);
 
     // reset compilation index
     m_cmpindex = 1;
   }
 
   // new album or opus passed
-  else if ( (key == keyinfo::name(keyinfo::ALBUM))
-  ||        (key == keyinfo::name(keyinfo::OPUS)) )
+  else if ( (keyID == keyinfo::ALBUM)
+  ||        (keyID == keyinfo::OPUS) )
   {
     // append data
-    m_kstack.push_back(key);
-    m_vstack.push_back(value);
+    push(keyID, key, value);
 
     // reset track number
     m_tracknum = 1;
   }
 
   // new title passed
-  else if (key == keyinfo::name(keyinfo::TITLE))
+  else if (keyID == keyinfo::TITLE)
   {
-    // append TITLE data
-    m_kstack.push_back(key);
-    m_vstack.push_back(value);
-
-    // numbers as strings
-    string tracknum;
-    string cmpindex;
+    // the names of the keys that are appended to each title
+    static const string tracknumber = keyinfo::name(keyinfo::TRACKNUMBER);
+    static const string cmpindex    = keyinfo::name(keyinfo::COMPILATIONINDEX);
 
-    // convert unsigned to string
-    stringstream conv;
-    conv << m_tracknum << " " << m_cmpindex;
-    conv >> tracknum >> cmpindex;
+    // append TITLE data
+    push(keyID, key, value);
 
     // always append TRACKNUMBER
-    m_kstack.push_back( keyinfo::name(keyinfo::TRACKNUMBER) );
-    m_vstack.push_back(tracknum);
+    push(keyinfo::TRACKNUMBER, tracknumber, msg::str(m_tracknum));
 
     // always append COMPILATIONINDEX
     // this key triggers the operation of next handlers
-    m_kstack.push_back( keyinfo::name(keyinfo::COMPILATIONINDEX) );
-    m_vstack.push_back(cmpindex);
+    push(keyinfo::COMPILATIONINDEX, cmpindex, msg::str(m_cmpindex));
 
     // flush all buffered values
-    for(unsigned n = 0; n < m_kstack.size(); n++)
+    for(unsigned n = 0; n < m_istack.size(); n++)
     {
       // notify next handler
-      m_next->OnData(m_kstack[n], m_vstack[n]);
+      m_next->OnData(m_istack[n], *m_kstack[n], m_vstack[n]);
 
       // check healthy state
       if ( !(m_next->healthy()) )
@@ -221,8 +214,7 @@ void StackHandler::OnData(const string& key, const string& value)
   else
   {
     // append data
-    m_kstack.push_back(key);
-    m_vstack.push_back(value);
+    push(keyID, key, value);
   }
 }
 
@@ -231,6 +223,19 @@ void StackHandler::OnData(const string& key, const string& value)
 // Internal methods                                             Internal methods
 // -----------------------------------------------------------------------------
 
+// ----
+// push
+// ----
+/*
+ *
+ */
+void StackHandler::push(unsigned keyID, const string& key, const string& value)
+{
+  m_istack.push_back(keyID);
+  m_kstack.push_back(&key);
+  m_vstack.push_back(value);
+}
+
 // ------------
 // str2unsigned
 // ------------
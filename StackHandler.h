@@ -80,7 +80,7 @@ public:
   /**
    *
    */
-  virtual void OnData(const string& key, const string& value);
+  virtual void OnData(unsigned keyID, const string& key, const string& value);
 
 
 protected:
@@ -89,6 +89,16 @@ protected:
   // Internal methods                                           Internal methods
   // ---------------------------------------------------------------------------
 
+  // ----
+  // push
+  // ----
+  /**
+   * @brief  This method appends the given tag to the stacks.
+   *
+   * The given key must be an interned name (see KeyTable::name()).
+   */
+  void push(unsigned keyID, const string& key, const string& value);
+
   // ------------
   // str2unsigned
   // ------------
@@ -104,8 +114,11 @@ private:
   // Attributes                                                       Attributes
   // ---------------------------------------------------------------------------
 
-  /// stack of keys
-  vector<string> m_kstack;
+  /// stack of key IDs
+  vector<unsigned> m_istack;
+
+  /// stack of keys (interned names)
+  vector<const string*> m_kstack;
 
   /// stack of values
   vector<string> m_vstack;
@@ -70,8 +70,8 @@ void TestHandler::OnEndParsing(bool healthy)
 /*
  *
  */
-void TestHandler::OnData(const string& key, const string& value)
+void TestHandler::OnData(unsigned keyID, const string& key, const string& value)
 {
-  cout << "OnData(\"" << key << "\", \"" << value << "\")" << endl;
+  cout << "OnData(" << keyID << ", \"" << key << "\", \"" << value << "\")" << endl;
 }
 
@@ -0,0 +1,148 @@
+// -----------------------------------------------------------------------------
+// TrackJob.cpp                                                     TrackJob.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref TrackJob class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <sstream>
+#include <iomanip>
+#include "TrackJob.h"
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// --------
+// TrackJob
+// --------
+/*
+ *
+ */
+TrackJob::TrackJob(const TrackRecord& track, bool singlePass)
+: singlePass(singlePass)
+{
+  // set comments in this order
+  static const keyinfo::KEYID order[] =
+  {
+    keyinfo::COMPILATIONID,
+    keyinfo::COMPILATIONINDEX,
+    keyinfo::AUTHOR,
+    keyinfo::COMPOSER,
+    keyinfo::LYRICIST,
+    keyinfo::OPUS,
+    keyinfo::VERSION,
+    keyinfo::ARRANGER,
+    keyinfo::PERFORMER,
+    keyinfo::CONDUCTOR,
+    keyinfo::ENSEMBLE,
+    keyinfo::ALBUMARTIST,
+    keyinfo::ALBUM,
+    keyinfo::GENRE,
+    keyinfo::DATE,
+    keyinfo::TRACKTOTAL,
+    keyinfo::TRACKNUMBER,
+    keyinfo::ARTIST,
+    keyinfo::TITLE,
+    keyinfo::COMMENT
+  };
+
+  // number of keys in this order
+  static const unsigned count = sizeof(order) / sizeof(order[0]);
+
+  // get special values
+  index    = track.get(keyinfo::COMPILATIONINDEX);
+  filename = track.get(keyinfo::FILENAME);
+  image    = track.get(keyinfo::IMAGE);
+
+  // compile filenames
+  stringstream strstr;
+  strstr << "track";
+  strstr << setw(3) << setfill('0') << index;
+  strstr << ".cdda.wav";
+  strstr << " ";
+  strstr << "track";
+  strstr << setw(3) << setfill('0') << index;
+  strstr << ".flac";
+
+  // get filenames (wav and flac)
+  strstr >> infile >> outfile;
+
+  // flac writes the final file at once
+  target = (singlePass && !filename.empty()) ? filename : outfile;
+
+  // the final file
+  destination = filename.empty() ? outfile : filename;
+
+  // get comments
+  for(unsigned n = 0; n < count; n++)
+  {
+    // get related value
+    const string& val = track.get(order[n]);
+
+    // don't set empty comments
+    if ( !val.empty() )
+    {
+      keys.push_back(order[n]);
+      values.push_back(val);
+    }
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Status information                                         Status information
+// -----------------------------------------------------------------------------
+
+// ------
+// digest
+// ------
+/*
+ * FNV-1a (64 bit) of all fields; each field is preceded by its size
+ */
+string TrackJob::digest() const
+{
+  // all fields
+  vector<string> fields;
+  fields.push_back(singlePass ? "1" : "0");
+  fields.push_back(infile);
+  fields.push_back(filename);
+  fields.push_back(image);
+  for(unsigned n = 0; n < keys.size(); n++)
+  {
+    fields.push_back( keyinfo::name(keys[n]) );
+    fields.push_back( values[n] );
+  }
+
+  // FNV offset basis
+  unsigned long long hash = 14695981039346656037ULL;
+
+  // hash all fields
+  for(unsigned i = 0; i < fields.size(); i++)
+  {
+    // size and content of the field
+    string data = to_string(fields[i].size()) + ":" + fields[i];
+
+    for(string::size_type k = 0; k < data.size(); k++)
+    {
+      hash ^= static_cast<unsigned char>(data[k]);
+      hash *= 1099511628211ULL;
+    }
+  }
+
+  // convert to hex digits
+  stringstream strstr;
+  strstr << hex << setw(16) << setfill('0') << hash;
+
+  // return digest
+  return strstr.str();
+}
+
@@ -0,0 +1,118 @@
+// -----------------------------------------------------------------------------
+// TrackJob.h                                                         TrackJob.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref TrackJob class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef TRACKJOB_H_INCLUDE_NO1
+#define TRACKJOB_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include "keyinfo.h"
+#include "TrackRecord.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// --------
+// TrackJob
+// --------
+/**
+ * @brief  Everything needed to encode and tag one track.
+ *
+ * A job is created from the tags of one track; the tag script and all
+ * other backends only render (or run) the job.
+ */
+class TrackJob
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the compilation index of the track
+  string index;
+
+  /// the wav file created by the rip script (trackNNN.cdda.wav)
+  string infile;
+
+  /// the flac file created by the encoder (trackNNN.flac)
+  string outfile;
+
+  /// the final name of the flac file (may be empty)
+  string filename;
+
+  /// the file written by flac (filename in single pass mode, else outfile)
+  string target;
+
+  /// the final flac file (filename or outfile)
+  string destination;
+
+  /// the comments are set by flac (no metaflac, no renaming)
+  bool singlePass;
+
+  /// the cover image (may be empty)
+  string image;
+
+  /// the keys of the comments to set (in this order)
+  vector<keyinfo::KEYID> keys;
+
+  /// the values of the comments to set (never empty)
+  vector<string> values;
+
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // --------
+  // TrackJob
+  // --------
+  /**
+   * @brief  This constructor creates the job for the given track.
+   *
+   * @param track       holds the tags of the track.
+   * @param singlePass  let flac set the comments and write the final file.
+   */
+  TrackJob(const TrackRecord& track, bool singlePass = false);
+
+
+  // ---------------------------------------------------------------------------
+  // Status information                                       Status information
+  // ---------------------------------------------------------------------------
+
+  // ------
+  // digest
+  // ------
+  /**
+   * @brief  This method returns a digest of everything that determines
+   *         the content and the name of the final file (except the wav
+   *         file and the image itself).
+   *
+   * @return  16 hex digits
+   */
+  string digest() const;
+
+};
+
+#endif  /* #ifndef TRACKJOB_H_INCLUDE_NO1 */
+
@@ -0,0 +1,238 @@
+// -----------------------------------------------------------------------------
+// TrackRecord.cpp                                               TrackRecord.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the implementation of the @ref TrackRecord class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include "TrackRecord.h"
+
+
+// -----------------------------------------------------------------------------
+// Construction                                                     Construction
+// -----------------------------------------------------------------------------
+
+// -----------
+// TrackRecord
+// -----------
+/*
+ *
+ */
+TrackRecord::TrackRecord()
+{
+  // nothing
+}
+
+
+// -----------------------------------------------------------------------------
+// Handling                                                             Handling
+// -----------------------------------------------------------------------------
+
+// -----
+// clear
+// -----
+/*
+ *
+ */
+void TrackRecord::clear()
+{
+  // empty used slots (keeps their capacity)
+  for(unsigned i = 0; i < m_order.size(); i++)
+  {
+    if (m_order[i].keyID < keyinfo::keyCount)
+    {
+      m_slots[ m_order[i].keyID ].clear();
+    }
+  }
+
+  // empty everything else
+  m_used.reset();
+  m_others.clear();
+  m_order.clear();
+}
+
+// ---
+// add
+// ---
+/*
+ *
+ */
+void TrackRecord::add(unsigned keyID, const string& key, const string& value)
+{
+  // key defined in keyinfo::KEYID
+  if (keyID < keyinfo::keyCount)
+  {
+    // update slot
+    m_slots[keyID] = value;
+
+    // key already known
+    if ( m_used.test(keyID) ) return;
+
+    // mark slot
+    m_used.set(keyID);
+
+    // remember position
+    m_positions[keyID] = m_order.size();
+
+    // remember order
+    m_order.push_back( Entry{keyID, &key, &m_slots[keyID]} );
+  }
+
+  // any other key
+  else
+  {
+    // insert key
+    pair<map<string, pair<string, unsigned> >::iterator, bool> it;
+    it = m_others.insert( make_pair(key, make_pair(value, m_order.size())) );
+
+    // key already known
+    if ( !it.second )
+    {
+      // update value
+      it.first->second.first = value;
+
+      // keep position
+      return;
+    }
+
+    // remember order
+    m_order.push_back( Entry{keyID, &key, &it.first->second.first} );
+  }
+}
+
+// ---
+// get
+// ---
+/*
+ *
+ */
+const string& TrackRecord::get(keyinfo::KEYID keyID) const
+{
+  // unused slots are empty
+  return m_slots[keyID];
+}
+
+// ---
+// get
+// ---
+/*
+ *
+ */
+const string& TrackRecord::get(const string& key) const
+{
+  // returned for unknown keys
+  static const string empty;
+
+  // get ID
+  unsigned keyID = keyinfo::find(key);
+
+  // key defined in keyinfo::KEYID
+  if (keyID < keyinfo::keyCount)
+  {
+    return m_slots[keyID];
+  }
+
+  // search other keys
+  map<string, pair<string, unsigned> >::const_iterator it = m_others.find(key);
+
+  // key not found
+  if ( it == m_others.end() ) return empty;
+
+  // key found
+  return it->second.first;
+}
+
+// --------
+// position
+// --------
+/*
+ *
+ */
+unsigned TrackRecord::position(const string& key) const
+{
+  // get ID
+  unsigned keyID = keyinfo::find(key);
+
+  // key defined in keyinfo::KEYID
+  if (keyID < keyinfo::keyCount)
+  {
+    return m_used.test(keyID) ? m_positions[keyID] : size();
+  }
+
+  // search other keys
+  map<string, pair<string, unsigned> >::const_iterator it = m_others.find(key);
+
+  // key not found
+  if ( it == m_others.end() ) return size();
+
+  // key found
+  return it->second.second;
+}
+
+
+// -----------------------------------------------------------------------------
+// Sequential access                                           Sequential access
+// -----------------------------------------------------------------------------
+
+// ----
+// size
+// ----
+/*
+ *
+ */
+unsigned TrackRecord::size() const
+{
+  return m_order.size();
+}
+
+// -----
+// keyID
+// -----
+/*
+ *
+ */
+unsigned TrackRecord::keyID(unsigned n) const
+{
+  return m_order[n].keyID;
+}
+
+// ---
+// key
+// ---
+/*
+ *
+ */
+const string& TrackRecord::key(unsigned n) const
+{
+  return *m_order[n].key;
+}
+
+// -----
+// value
+// -----
+/*
+ *
+ */
+string& TrackRecord::value(unsigned n)
+{
+  return *m_order[n].value;
+}
+
+// -----
+// value
+// -----
+/*
+ *
+ */
+const string& TrackRecord::value(unsigned n) const
+{
+  return *m_order[n].value;
+}
+
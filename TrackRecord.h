@@ -0,0 +1,211 @@
+// -----------------------------------------------------------------------------
+// TrackRecord.h                                                   TrackRecord.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file holds the definition of the @ref TrackRecord class.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef TRACKRECORD_H_INCLUDE_NO1
+#define TRACKRECORD_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <map>
+#include <bitset>
+#include <vector>
+#include <string>
+#include "keyinfo.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------
+// TrackRecord
+// -----------
+/**
+ * @brief  This class holds the tags of one track.
+ *
+ * Every key defined in keyinfo::KEYID has its own slot, all other keys
+ * (the ones starting with an underscore) are kept in a small map. The
+ * order in which the tags were added is remembered as well.
+ */
+class TrackRecord
+{
+
+public:
+
+  // ---------------------------------------------------------------------------
+  // Construction                                                   Construction
+  // ---------------------------------------------------------------------------
+
+  // -----------
+  // TrackRecord
+  // -----------
+  /**
+   * @brief  The standard-constructor.
+   */
+  TrackRecord();
+
+  /// a record points into itself and can't be copied
+  TrackRecord(const TrackRecord&) = delete;
+
+  /// a record points into itself and can't be copied
+  TrackRecord& operator=(const TrackRecord&) = delete;
+
+
+  // ---------------------------------------------------------------------------
+  // Handling                                                           Handling
+  // ---------------------------------------------------------------------------
+
+  // -----
+  // clear
+  // -----
+  /**
+   * @brief  This method removes all tags.
+   */
+  void clear();
+
+  // ---
+  // add
+  // ---
+  /**
+   * @brief  This method adds a tag to the record.
+   *
+   * The key has to stay valid as long as the tag is part of the record.
+   * A key that is added twice keeps its position and gets the new value.
+   */
+  void add(unsigned keyID, const string& key, const string& value);
+
+  // ---
+  // get
+  // ---
+  /**
+   * @brief  This method returns the value of a key defined in keyinfo::KEYID.
+   */
+  const string& get(keyinfo::KEYID keyID) const;
+
+  // ---
+  // get
+  // ---
+  /**
+   * @brief  This method returns the value of any key.
+   */
+  const string& get(const string& key) const;
+
+  // --------
+  // position
+  // --------
+  /**
+   * @brief  This method returns the position of the given key.
+   *
+   * @return  size() if the key is not part of the record
+   */
+  unsigned position(const string& key) const;
+
+
+  // ---------------------------------------------------------------------------
+  // Sequential access                                         Sequential access
+  // ---------------------------------------------------------------------------
+
+  // ----
+  // size
+  // ----
+  /**
+   * @brief  This method returns the number of tags.
+   */
+  unsigned size() const;
+
+  // -----
+  // keyID
+  // -----
+  /**
+   * @brief  This method returns the ID of the n-th tag.
+   */
+  unsigned keyID(unsigned n) const;
+
+  // ---
+  // key
+  // ---
+  /**
+   * @brief  This method returns the key of the n-th tag.
+   */
+  const string& key(unsigned n) const;
+
+  // -----
+  // value
+  // -----
+  /**
+   * @brief  This method returns the value of the n-th tag.
+   */
+  string& value(unsigned n);
+
+  // -----
+  // value
+  // -----
+  /**
+   * @brief  This method returns the value of the n-th tag.
+   */
+  const string& value(unsigned n) const;
+
+
+private:
+
+  // ---------------------------------------------------------------------------
+  // Types                                                                 Types
+  // ---------------------------------------------------------------------------
+
+  // -----
+  // Entry
+  // -----
+  /**
+   * @brief  One tag in the order of arrival.
+   */
+  struct Entry
+  {
+    /// the ID of the key
+    unsigned keyID;
+
+    /// the key (interned name)
+    const string* key;
+
+    /// the value (a slot or an element of the map)
+    string* value;
+  };
+
+
+  // ---------------------------------------------------------------------------
+  // Attributes                                                       Attributes
+  // ---------------------------------------------------------------------------
+
+  /// the values of the keys defined in keyinfo::KEYID
+  string m_slots[keyinfo::keyCount];
+
+  /// the slots that are in use
+  bitset<keyinfo::keyCount> m_used;
+
+  /// the positions of the used slots
+  unsigned m_positions[keyinfo::keyCount];
+
+  /// the values and positions of all other keys
+  map<string, pair<string, unsigned> > m_others;
+
+  /// the tags in the order of arrival
+  vector<Entry> m_order;
+
+};
+
+#endif  /* #ifndef TRACKRECORD_H_INCLUDE_NO1 */
+
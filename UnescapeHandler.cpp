@@ -61,7 +61,7 @@ void UnescapeHandler::OnBeginParsing(const string& filename)
 /*
  *
  */
-void UnescapeHandler::OnData(const string& key, const string& value)
+void UnescapeHandler::OnData(unsigned keyID, const string& key, const string& value)
 {
   // no handler set
   if (m_next == 0) return;
@@ -76,7 +76,7 @@ void UnescapeHandler::OnData(const string& key, const string& value)
   if ( unescape(value, plain) )
   {
     // notify next handler
-    m_next->OnData(key, plain);
+    m_next->OnData(keyID, key, plain);
   }
 
   else
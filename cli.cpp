@@ -16,6 +16,7 @@
 #include <sstream>
 #include <iostream>
 #include "message.h"
+#include "keyinfo.h"
 #include "cli.h"
 
 
@@ -42,6 +43,22 @@ cli::cli()
 
   // get filename from command-line
   source = PARAM;
+
+  // parse one file after another
+  jobs = 1;
+
+  // encode one track per processor
+  encoders = 0;
+
+  // set comments with metaflac
+  singlePass = false;
+
+  // encode tracks with flac
+  builtin = false;
+
+  // print all rows in input order
+  distinct = false;
+  collate  = false;
 }
 
 
@@ -82,14 +99,36 @@ void cli::help(const std::string& xname) const
   cout << endl;
   cout << "  -h  show help and exit" << endl;
   cout << "  -v  show version and exit" << endl;
+  cout << "  -b  compile each file into a binary image <file>.bin (used while it is up to date)" << endl;
+  cout << "  -c  show a compact tag script (one line per track)" << endl;
   cout << "  -d  show database lines" << endl;
+  cout << "  -e  encode with the built-in encoder instead of flac (requires -x)" << endl;
   cout << "  -k  show the list of keys" << endl;
+  cout << "  -l  sort the rows of -Q by the collation of the current locale (by all columns without -S)" << endl;
   cout << "  -L  show the list of commands" << endl;
+  cout << "  -m  show a makefile that encodes (only) the outdated tracks" << endl;
   cout << "  -o  show a brief overview" << endl;
   cout << "  -O  show a verbose overview" << endl;
+  cout << "  -p  show a tag script that encodes tracks in parallel" << endl;
   cout << "  -s  create auxiliary bash scripts and exit" << endl;
+  cout << "  -t  let flac set the comments and write the final file (no metaflac)" << endl;
+  cout << "  -u  print each row of -Q only once" << endl;
+  cout << "  -x  encode and tag the tracks instead of showing the tag script" << endl;
   cout << "  -z  read NUL terminated filenames from stdin" << endl;
   cout << endl;
+  cout << "  -g <k>  show the first of the comma separated comments <k> of flac files" << endl;
+  cout << "  -T <c>  replace the comments of the same name by <c> (NAME=value) in flac files" << endl;
+  cout << "  -Q <k>  print the comma separated keys <k> of all tracks, separated by '|'" << endl;
+  cout << "  -S <k>  sort the rows of -Q by the comma separated keys <k>" << endl;
+  cout << "  -j <n>  parse up to <n> files at once (requires -z)" << endl;
+  cout << "  -n <n>  encode up to <n> tracks (resp. frames with -e) at once (requires -x)" << endl;
+  cout << "  -H <f>  write the html page of each file and the html index <f> of all albums" << endl;
+  cout << "  -I <d>  write one importable file per person (resp. opus) of all tracks into <d>" << endl;
+  cout << "  -D <f>  parse only new (resp. changed) files, take all other tracks from catalog <f>" << endl;
+  cout << "          (requires -d, -H, -I or -Q)" << endl;
+  cout << "  -C <d>  reuse the audio of unchanged wav files cached in <d> (requires -x)" << endl;
+  cout << "  -J <f>  skip the tracks recorded in journal <f>, record finished ones (requires -x)" << endl;
+  cout << endl;
 }
 
 // -------
@@ -116,11 +155,14 @@ bool cli::parse(int argc, char** argv)
   // don't print error messages
   opterr = 0;
 
+  // the names of the sort keys (option -S)
+  vector<string> sortKeys;
+
   // ASCII code of the detected option
   int optchar;
 
   // parse all given options
-  while ((optchar = getopt(argc, argv, ":hvdkLoOsz")) != -1)
+  while ((optchar = getopt(argc, argv, ":hvbcdekLlmoOpstuxzj:n:C:D:H:I:J:g:Q:S:T:")) != -1)
   {
     // use this object to convert arguments
     stringstream argstream((optarg == 0) ? "" : optarg);
@@ -128,6 +170,12 @@ bool cli::parse(int argc, char** argv)
     // the ID of the script to generate
     string scriptid;
 
+    // the name of a comment
+    string name;
+
+    // the name of a key
+    string key;
+
     // analyze (short) options
     switch (optchar)
     {
@@ -141,6 +189,16 @@ bool cli::parse(int argc, char** argv)
                 // stop parsing
                 return true;
 
+      case 'b': operation = COMPILE_IMAGES;
+
+                // next option
+                break;
+
+      case 'c': operation = SHOW_COMPACT_SCRIPT;
+
+                // next option
+                break;
+
       case 'd': operation = SHOW_DBASE_LINES;
 
                 // next option
@@ -156,6 +214,11 @@ bool cli::parse(int argc, char** argv)
                 // stop parsing
                 return true;
 
+      case 'm': operation = SHOW_MAKEFILE;
+
+                // next option
+                break;
+
       case 'o': operation = SHOW_OVERVIEW_BRIEF;
 
                 // next option
@@ -166,16 +229,198 @@ bool cli::parse(int argc, char** argv)
                 // next option
                 break;
 
+      case 'p': operation = SHOW_PARALLEL_SCRIPT;
+
+                // next option
+                break;
+
       case 's': operation = CREATE_SCRIPTS;
 
                 // stop parsing
                 return true;
 
+      case 't': singlePass = true;
+
+                // next option
+                break;
+
+      case 'x': operation = RUN_JOBS;
+
+                // next option
+                break;
+
+      case 'l': collate = true;
+
+                // next option
+                break;
+
+      case 'u': distinct = true;
+
+                // next option
+                break;
+
+      case 'Q': operation = RUN_QUERY;
+
+                // get keys to print
+                queryKeys.clear();
+                while ( getline(argstream, key, ',') )
+                {
+                  // check key
+                  if ( (key != "CDFILE") && !keyinfo::isWritable(key) )
+                  {
+                    // notify user
+                    msg::err( msg::catq("invalid key: ", key) );
+
+                    // signalize trouble
+                    return false;
+                  }
+
+                  queryKeys.push_back(key);
+                }
+
+                // check keys
+                if ( queryKeys.empty() )
+                {
+                  // notify user
+                  msg::err( msg::catq("invalid list of keys: ", optarg) );
+
+                  // signalize trouble
+                  return false;
+                }
+
+                // next option
+                break;
+
+      case 'S': // get sort keys
+                sortKeys.clear();
+                while ( getline(argstream, key, ',') )
+                {
+                  sortKeys.push_back(key);
+                }
+
+                // check keys
+                if ( sortKeys.empty() )
+                {
+                  // notify user
+                  msg::err( msg::catq("invalid list of keys: ", optarg) );
+
+                  // signalize trouble
+                  return false;
+                }
+
+                // next option
+                break;
+
+      case 'e': builtin = true;
+
+                // next option
+                break;
+
       case 'z': source = STDIN;
 
                 // next option
                 break;
 
+      case 'j': // get number of threads
+                if ( !(argstream >> jobs) || (jobs == 0) )
+                {
+                  // notify user
+                  msg::err( msg::catq("invalid number of jobs: ", optarg) );
+
+                  // signalize trouble
+                  return false;
+                }
+
+                // next option
+                break;
+
+      case 'n': // get number of encoders
+                if ( !(argstream >> encoders) || (encoders == 0) )
+                {
+                  // notify user
+                  msg::err( msg::catq("invalid number of encoders: ", optarg) );
+
+                  // signalize trouble
+                  return false;
+                }
+
+                // next option
+                break;
+
+      case 'g': operation = SHOW_FLAC_TAGS;
+
+                // get names of comments
+                flacKeys.clear();
+                while ( getline(argstream, name, ',') )
+                {
+                  if ( !name.empty() ) flacKeys.push_back(name);
+                }
+
+                // check names
+                if ( flacKeys.empty() )
+                {
+                  // notify user
+                  msg::err( msg::catq("invalid list of comments: ", optarg) );
+
+                  // signalize trouble
+                  return false;
+                }
+
+                // next option
+                break;
+
+      case 'T': operation = UPDATE_FLAC_TAGS;
+
+                // get comment
+                flacTag = optarg;
+
+                // check field name
+                if ( (flacTag.find('=') == 0) || (flacTag.find('=') == string::npos) )
+                {
+                  // notify user
+                  msg::err( msg::catq("invalid comment: ", optarg) );
+
+                  // signalize trouble
+                  return false;
+                }
+
+                // next option
+                break;
+
+      case 'C': // get name of cache directory
+                cache = optarg;
+
+                // next option
+                break;
+
+      case 'H': operation = WRITE_HTML_INDEX;
+
+                // get name of the index file
+                htmlIndex = optarg;
+
+                // next option
+                break;
+
+      case 'D': // get name of the catalog
+                catalog = optarg;
+
+                // next option
+                break;
+
+      case 'I': operation = WRITE_IMPORT_FILES;
+
+                // get name of the directory
+                importDir = optarg;
+
+                // next option
+                break;
+
+      case 'J': // get name of journal
+                journal = optarg;
+
+                // next option
+                break;
+
       case ':': msg::err("missing argument");
 
                 // signalize trouble
@@ -188,9 +433,169 @@ bool cli::parse(int argc, char** argv)
     }
   }
 
+  // rows are only sorted (resp. dropped) by option -Q
+  if ( (distinct || collate || !sortKeys.empty()) && (operation != RUN_QUERY) )
+  {
+    // notify user
+    msg::err("options -l, -S and -u require option -Q");
+
+    // signalize trouble
+    return false;
+  }
+
+  // get positions of the sort columns
+  sortColumns.clear();
+  for(unsigned i = 0; i < sortKeys.size(); i++)
+  {
+    // find column
+    unsigned n = 0;
+    while ( (n < queryKeys.size()) && (queryKeys[n] != sortKeys[i]) ) n++;
+
+    // sort key not printed
+    if (n == queryKeys.size())
+    {
+      // notify user
+      msg::err( msg::catq("sort key is not a column of option -Q: ", sortKeys[i]) );
+
+      // signalize trouble
+      return false;
+    }
+
+    sortColumns.push_back(n);
+  }
+
+  // the number of encoders is only used by option -x
+  if ( (encoders > 0) && (operation != RUN_JOBS) )
+  {
+    // notify user
+    msg::err("option -n requires option -x");
+
+    // signalize trouble
+    return false;
+  }
+
+  // the cache is only used by option -x
+  if ( !cache.empty() && (operation != RUN_JOBS) )
+  {
+    // notify user
+    msg::err("option -C requires option -x");
+
+    // signalize trouble
+    return false;
+  }
+
+  // the built-in encoder is only used by option -x
+  if ( builtin && (operation != RUN_JOBS) )
+  {
+    // notify user
+    msg::err("option -e requires option -x");
+
+    // signalize trouble
+    return false;
+  }
+
+  // the cache holds audio data encoded by flac
+  if ( builtin && !cache.empty() )
+  {
+    // notify user
+    msg::err("option -e can't be combined with option -C");
+
+    // signalize trouble
+    return false;
+  }
+
+  // the journal is only kept by option -x
+  if ( !journal.empty() && (operation != RUN_JOBS) )
+  {
+    // notify user
+    msg::err("option -J requires option -x");
+
+    // signalize trouble
+    return false;
+  }
+
+  // flac is only called by the tag script (resp. options -m and -x)
+  if ( singlePass
+  &&   (operation != DEFAULT)
+  &&   (operation != SHOW_PARALLEL_SCRIPT)
+  &&   (operation != SHOW_COMPACT_SCRIPT)
+  &&   (operation != SHOW_MAKEFILE)
+  &&   (operation != RUN_JOBS) )
+  {
+    // notify user
+    msg::err("option -t requires a tag script (resp. option -m or -x)");
+
+    // signalize trouble
+    return false;
+  }
+
+  // encoders are run by one file at a time
+  if ( (jobs > 1) && (operation == RUN_JOBS) )
+  {
+    // notify user
+    msg::err("option -j can't be combined with option -x");
+
+    // signalize trouble
+    return false;
+  }
+
+  // all tracks are collected by one process chain
+  if ( (jobs > 1) && ((operation == RUN_QUERY) || (operation == WRITE_IMPORT_FILES) || (operation == COMPILE_IMAGES)) )
+  {
+    // notify user
+    msg::err("option -j can't be combined with option -Q, -I (resp. -b)");
+
+    // signalize trouble
+    return false;
+  }
+
+  // flac files are read one after another
+  if ( (jobs > 1) && ((operation == SHOW_FLAC_TAGS) || (operation == UPDATE_FLAC_TAGS)) )
+  {
+    // notify user
+    msg::err("option -j can't be combined with option -g (resp. -T)");
+
+    // signalize trouble
+    return false;
+  }
+
+  // the catalog is only used by options -d, -H, -I and -Q
+  if ( !catalog.empty()
+  &&   (operation != SHOW_DBASE_LINES)
+  &&   (operation != WRITE_HTML_INDEX)
+  &&   (operation != WRITE_IMPORT_FILES)
+  &&   (operation != RUN_QUERY) )
+  {
+    // notify user
+    msg::err("option -D requires option -d, -H, -I or -Q");
+
+    // signalize trouble
+    return false;
+  }
+
+  // the catalog is read and written by one thread
+  if ( (jobs > 1) && !catalog.empty() )
+  {
+    // notify user
+    msg::err("option -j can't be combined with option -D");
+
+    // signalize trouble
+    return false;
+  }
+
   // check source
   if (source == PARAM)
   {
+    // parallel parsing needs a list of files
+    if (jobs > 1)
+    {
+      // notify user
+      msg::err("option -j requires option -z");
+
+      // signalize trouble
+      return false;
+    }
+
     // get number of positional arguments
     unsigned pcount = (argc - optind);
 
@@ -20,6 +20,7 @@
 // Includes                                                             Includes
 // -----------------------------------------------------------------------------
 #include <string>
+#include <vector>
 
 
 // ---
@@ -48,6 +49,16 @@ public:
     SHOW_OVERVIEW_BRIEF,
     SHOW_OVERVIEW_VERBOSE,
     SHOW_DBASE_LINES,
+    SHOW_PARALLEL_SCRIPT,
+    SHOW_MAKEFILE,
+    SHOW_COMPACT_SCRIPT,
+    RUN_JOBS,
+    RUN_QUERY,
+    WRITE_IMPORT_FILES,
+    WRITE_HTML_INDEX,
+    COMPILE_IMAGES,
+    SHOW_FLAC_TAGS,
+    UPDATE_FLAC_TAGS,
     CREATE_SCRIPTS
   }
   operation;
@@ -63,6 +74,51 @@ public:
   /// the name of the file to parse
   std::string filename;
 
+  /// the number of threads that parse files read from stdin
+  unsigned jobs;
+
+  /// the number of tracks encoded at once (0 means one per processor)
+  unsigned encoders;
+
+  /// let flac set the comments and write the final file
+  bool singlePass;
+
+  /// encode tracks with the built-in encoder instead of flac
+  bool builtin;
+
+  /// the journal of finished tracks (empty means none)
+  std::string journal;
+
+  /// the directory of encoded audio data (empty means none)
+  std::string cache;
+
+  /// the keys to print per track (option -Q)
+  std::vector<std::string> queryKeys;
+
+  /// the positions of the sort columns among the keys to print
+  std::vector<unsigned> sortColumns;
+
+  /// drop duplicate rows
+  bool distinct;
+
+  /// sort by the collation of the current locale
+  bool collate;
+
+  /// the directory that receives the importable files (option -I)
+  std::string importDir;
+
+  /// the html index of all albums (option -H)
+  std::string htmlIndex;
+
+  /// the catalog of recorded tracks (empty means none)
+  std::string catalog;
+
+  /// the names of the comments to show (the first one found per flac file)
+  std::vector<std::string> flacKeys;
+
+  /// the comment that replaces all comments of the same name
+  std::string flacTag;
+
 
   // ---------------------------------------------------------------------------
   // Construction                                                   Construction
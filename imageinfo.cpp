@@ -0,0 +1,235 @@
+// -----------------------------------------------------------------------------
+// imageinfo.cpp                                                   imageinfo.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file defines all members of the @ref imageinfo namespace.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <fstream>
+#include <sstream>
+#include "imageinfo.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------------------------------------------------------------------------
+// Definitions                                                       Definitions
+// -----------------------------------------------------------------------------
+namespace imageinfo
+{
+
+  // ----
+  // byte
+  // ----
+  /*
+   * the n-th byte of data (0 behind the end)
+   */
+  unsigned byte(const string& data, string::size_type n)
+  {
+    return (n < data.size()) ? static_cast<unsigned char>(data[n]) : 0;
+  }
+
+  // ---------
+  // bigEndian
+  // ---------
+  /*
+   * the big endian number of the given size at position n
+   */
+  unsigned bigEndian(const string& data, string::size_type n, unsigned size)
+  {
+    unsigned number = 0;
+
+    for(unsigned i = 0; i < size; i++)
+    {
+      number = (number << 8) | byte(data, n + i);
+    }
+
+    return number;
+  }
+
+  // ----------
+  // inspectPNG
+  // ----------
+  /*
+   * the header (IHDR) is the first chunk; PLTE precedes the image data
+   */
+  bool inspectPNG(const string& data, Info& info)
+  {
+    // signature and IHDR
+    if ( (data.size() < 33) || (data.compare(12, 4, "IHDR") != 0) ) return false;
+
+    // get header
+    unsigned bits  = byte(data, 24);
+    unsigned color = byte(data, 25);
+
+    // number of channels per color type
+    unsigned channels = 0;
+    switch (color)
+    {
+      case 0: channels = 1; break;  // grayscale
+      case 2: channels = 3; break;  // truecolor
+      case 3: channels = 1; break;  // indexed
+      case 4: channels = 2; break;  // grayscale with alpha
+      case 6: channels = 4; break;  // truecolor with alpha
+      default: return false;
+    }
+
+    // set properties
+    info.format = "PNG";
+    info.mime   = "image/png";
+    info.width  = bigEndian(data, 16, 4);
+    info.height = bigEndian(data, 20, 4);
+    info.depth  = bits * channels;
+    info.colors = 0;
+
+    // search palette of indexed images
+    for(string::size_type n = 8; (color == 3) && (n + 8 <= data.size()); )
+    {
+      // get chunk
+      unsigned size = bigEndian(data, n, 4);
+
+      // palette found
+      if (data.compare(n + 4, 4, "PLTE") == 0)
+      {
+        info.colors = size / 3;
+        break;
+      }
+
+      // image data found
+      if (data.compare(n + 4, 4, "IDAT") == 0) break;
+
+      // next chunk (length, type, data, crc)
+      n += size + 12;
+    }
+
+    // signalize success
+    return true;
+  }
+
+  // -----------
+  // inspectJPEG
+  // -----------
+  /*
+   * the dimensions are stored in the first start of frame segment
+   */
+  bool inspectJPEG(const string& data, Info& info)
+  {
+    // skip start of image
+    string::size_type n = 2;
+
+    // check all segments
+    while (n + 4 <= data.size())
+    {
+      // no marker found
+      if (byte(data, n) != 0xff) return false;
+
+      // get marker
+      unsigned marker = byte(data, n + 1);
+
+      // skip fill bytes
+      if (marker == 0xff)
+      {
+        n++;
+        continue;
+      }
+
+      // markers without data (TEM, RSTn, SOI, EOI)
+      if ( (marker == 0x01) || ((marker >= 0xd0) && (marker <= 0xd9)) )
+      {
+        n += 2;
+        continue;
+      }
+
+      // start of frame found (except DHT, JPG and DAC)
+      if ( (marker >= 0xc0) && (marker <= 0xcf)
+      &&   (marker != 0xc4) && (marker != 0xc8) && (marker != 0xcc) )
+      {
+        // incomplete segment
+        if (n + 10 > data.size()) return false;
+
+        // set properties
+        info.format = "JPEG";
+        info.mime   = "image/jpeg";
+        info.height = bigEndian(data, n + 5, 2);
+        info.width  = bigEndian(data, n + 7, 2);
+        info.depth  = byte(data, n + 4) * byte(data, n + 9);
+        info.colors = 0;
+
+        // signalize success
+        return true;
+      }
+
+      // start of scan found before the frame
+      if (marker == 0xda) return false;
+
+      // next segment
+      n += 2 + bigEndian(data, n + 2, 2);
+    }
+
+    // no frame found
+    return false;
+  }
+
+  // -------
+  // inspect
+  // -------
+  /*
+   *
+   */
+  bool inspect(const string& data, Info& info)
+  {
+    // PNG signature
+    if (data.compare(0, 8, "\x89PNG\r\n\x1a\n") == 0)
+    {
+      return inspectPNG(data, info);
+    }
+
+    // JPEG start of image
+    if (data.compare(0, 3, "\xff\xd8\xff") == 0)
+    {
+      return inspectJPEG(data, info);
+    }
+
+    // unknown format
+    return false;
+  }
+
+  // ----
+  // load
+  // ----
+  /*
+   *
+   */
+  bool load(const string& filename, string& data)
+  {
+    // open file
+    ifstream file(filename.c_str(), ios::in | ios::binary);
+    if ( !file ) return false;
+
+    // read file
+    stringstream buffer;
+    buffer << file.rdbuf();
+
+    // check stream
+    if ( file.bad() ) return false;
+
+    // get content
+    data = buffer.str();
+
+    // signalize success
+    return true;
+  }
+
+}
+
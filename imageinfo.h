@@ -0,0 +1,91 @@
+// -----------------------------------------------------------------------------
+// imageinfo.h                                                       imageinfo.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file declares 'public' members of the @ref imageinfo namespace.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef IMAGEINFO_H_INCLUDE_NO1
+#define IMAGEINFO_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <string>
+
+
+// ---------
+// imageinfo
+// ---------
+/**
+ * @brief  The @a imageinfo namespace reads the properties of a cover
+ *         image (JPEG or PNG) from its header.
+ */
+namespace imageinfo
+{
+
+  // ----
+  // Info
+  // ----
+  /**
+   * @brief  The properties of an image.
+   */
+  struct Info
+  {
+    /// the format ("JPEG" or "PNG")
+    std::string format;
+
+    /// the mime type ("image/jpeg" or "image/png")
+    std::string mime;
+
+    /// the width in pixels
+    unsigned width;
+
+    /// the height in pixels
+    unsigned height;
+
+    /// the number of bits per pixel
+    unsigned depth;
+
+    /// the number of colors of an indexed image (0 otherwise)
+    unsigned colors;
+  };
+
+  // -------
+  // inspect
+  // -------
+  /**
+   * @brief  This function reads the properties of the given image.
+   *
+   * @param[in]  data  the content of the image file
+   * @param[out] info  the properties of the image
+   *
+   * @return  false if the data is neither a JPEG nor a PNG image
+   */
+  bool inspect(const std::string& data, Info& info);
+
+  // ----
+  // load
+  // ----
+  /**
+   * @brief  This function reads a whole file.
+   *
+   * @param[in]  filename  the name of the file
+   * @param[out] data      the content of the file
+   *
+   * @return  false if the file can't be read
+   */
+  bool load(const std::string& filename, std::string& data);
+
+}
+
+#endif  /* #ifndef IMAGEINFO_H_INCLUDE_NO1 */
+
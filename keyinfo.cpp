@@ -12,6 +12,7 @@
 // -----------------------------------------------------------------------------
 // Includes                                                             Includes
 // -----------------------------------------------------------------------------
+#include <vector>
 #include "keyinfo.h"
 
 
@@ -21,38 +22,205 @@
 namespace keyinfo
 {
 
-  /// the list of key names (must be synchronous with the KEYID enum)
-  const char *const keys[] =
-  {
-    "ALBUM",
-    "ALBUMARTIST",
-    "ARRANGER",
-    "ARTIST",
-    "AUTHOR",
-    "COMMENT",
-    "COMPILATIONID",
-    "COMPILATIONINDEX",
-    "COMPOSER",
-    "CONDUCTOR",
-    "DATE",
-    "ENSEMBLE",
-    "FILENAME",
-    "GENRE",
-    "IMAGE",
-    "LYRICIST",
-    "OPUS",
-    "PERFORMER",
-    "TITLE",
-    "TRACKNUMBER",
-    "TRACKTOTAL",
-    "VERSION"
+  /// the key is writable
+  constexpr unsigned WRITABLE = 1;
+
+  /// the key is written to the flac file as vorbis comment
+  constexpr unsigned VORBIS = 2;
+
+  // ------
+  // length
+  // ------
+  /**
+   * @brief  This function returns the number of characters in the given
+   *         string (strlen at compile time).
+   */
+  constexpr unsigned length(const char* s)
+  {
+    unsigned n = 0;
+
+    while (s[n] != 0) n++;
+
+    return n;
+  }
+
+  // ------
+  // KeyDef
+  // ------
+  /**
+   * @brief  The properties of one key.
+   */
+  struct KeyDef
+  {
+    /// the size is taken from the name
+    constexpr KeyDef(const char* n, unsigned a)
+    : name(n), size( length(n) ), attributes(a)
+    {
+    }
+
+    /// the key's name
+    const char* name;
+
+    /// the number of characters in the key's name
+    unsigned size;
+
+    /// the key's attributes (bitset)
+    unsigned attributes;
   };
 
-  // number of keys
-  const unsigned keyCount = 22;
+  /// the list of keys (must be synchronous with the KEYID enum)
+  constexpr KeyDef keys[] =
+  {
+    { "ALBUM",            WRITABLE | VORBIS },
+    { "ALBUMARTIST",      WRITABLE | VORBIS },
+    { "ARRANGER",         WRITABLE | VORBIS },
+    { "ARTIST",           WRITABLE | VORBIS },
+    { "AUTHOR",           WRITABLE | VORBIS },
+    { "COMMENT",          WRITABLE | VORBIS },
+    { "COMPILATIONID",    WRITABLE | VORBIS },
+    { "COMPILATIONINDEX",            VORBIS },
+    { "COMPOSER",         WRITABLE | VORBIS },
+    { "CONDUCTOR",        WRITABLE | VORBIS },
+    { "DATE",             WRITABLE | VORBIS },
+    { "ENSEMBLE",         WRITABLE | VORBIS },
+    { "FILENAME",         WRITABLE          },
+    { "GENRE",            WRITABLE | VORBIS },
+    { "IMAGE",            WRITABLE          },
+    { "LYRICIST",         WRITABLE | VORBIS },
+    { "OPUS",             WRITABLE | VORBIS },
+    { "PERFORMER",        WRITABLE | VORBIS },
+    { "TITLE",            WRITABLE | VORBIS },
+    { "TRACKNUMBER",      WRITABLE | VORBIS },
+    { "TRACKTOTAL",       WRITABLE | VORBIS },
+    { "VERSION",          WRITABLE | VORBIS }
+  };
+
+  static_assert(sizeof(keys) / sizeof(keys[0]) == keyCount, "keyinfo::keys must define each KEYID");
+
+  /// number of bits that select a slot
+  constexpr unsigned slotBits = 6;
 
-  // COMPILATIONINDEX
-  const unsigned maxNameSize = 16;
+  /// number of slots in the hash table
+  constexpr unsigned slotCount = 1u << slotBits;
+
+  /// this slot is not used by any key
+  constexpr unsigned char EMPTY = 0xff;
+
+  // ----
+  // hash
+  // ----
+  /**
+   * @brief  FNV-1a with a variable offset basis.
+   *
+   * The slot is taken from the upper bits, which are better mixed.
+   */
+  constexpr unsigned hash(const char* s, unsigned size, unsigned seed)
+  {
+    unsigned h = seed;
+
+    for(unsigned i = 0; i < size; i++)
+    {
+      h = (h ^ static_cast<unsigned char>(s[i])) * 16777619u;
+    }
+
+    return h;
+  }
+
+  // ---------
+  // HashTable
+  // ---------
+  /**
+   * @brief  A perfect hash table that maps hash values to key IDs.
+   */
+  struct HashTable
+  {
+    /// the seed that maps all keys to different slots
+    unsigned seed;
+
+    /// the ID of the key in each slot
+    unsigned char slots[slotCount];
+  };
+
+  // ---------
+  // fillTable
+  // ---------
+  /**
+   * @brief  This function puts all keys into a table using the given seed.
+   *
+   * @return  false if two keys use the same slot
+   */
+  constexpr bool fillTable(HashTable& table, unsigned seed)
+  {
+    table.seed = seed;
+
+    for(unsigned i = 0; i < slotCount; i++)
+    {
+      table.slots[i] = EMPTY;
+    }
+
+    for(unsigned k = 0; k < keyCount; k++)
+    {
+      unsigned i = hash(keys[k].name, keys[k].size, seed) >> (32 - slotBits);
+
+      // collision
+      if (table.slots[i] != EMPTY) return false;
+
+      table.slots[i] = k;
+    }
+
+    return true;
+  }
+
+  // ---------
+  // makeTable
+  // ---------
+  /**
+   * @brief  This function searches the first seed that works.
+   */
+  constexpr HashTable makeTable()
+  {
+    HashTable table = { 0, {} };
+
+    // start with FNV's offset basis
+    unsigned seed = 2166136261u;
+
+    while ( !fillTable(table, seed) ) seed++;
+
+    return table;
+  }
+
+  /// the perfect hash table (created at compile time)
+  constexpr HashTable table = makeTable();
+
+  // --------
+  // validate
+  // --------
+  /**
+   * @brief  This function checks the sizes and the order of the keys.
+   */
+  constexpr bool validate()
+  {
+    for(unsigned k = 0; k < keyCount; k++)
+    {
+      // check size
+      if (keys[k].size > maxNameSize) return false;
+
+      // check order
+      if (k > 0)
+      {
+        for(unsigned i = 0; ; i++)
+        {
+          if (keys[k - 1].name[i] < keys[k].name[i]) break;
+          if (keys[k - 1].name[i] > keys[k].name[i]) return false;
+          if (keys[k].name[i] == 0) return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  static_assert(validate(), "keyinfo::keys must be sorted and sized correctly");
 
 
   // ----
@@ -61,9 +229,22 @@ namespace keyinfo
   /*
    *
    */
-  string name(unsigned keyID)
+  const string& name(unsigned keyID)
   {
-    return keys[keyID];
+    // the names as strings (created once)
+    static const vector<string> names = []
+    {
+      vector<string> list;
+
+      for(unsigned k = 0; k < keyCount; k++)
+      {
+        list.push_back(keys[k].name);
+      }
+
+      return list;
+    }();
+
+    return names[keyID];
   }
 
   // ---------
@@ -86,11 +267,7 @@ namespace keyinfo
    */
   bool isWritable(unsigned keyID)
   {
-    // only COMPILATIONINDEX is not writable
-    if (keyID == COMPILATIONINDEX) return false;
-
-    // all other keys are writable
-    return true;
+    return (keyID < keyCount) && (keys[keyID].attributes & WRITABLE);
   }
 
   // ---------------
@@ -101,12 +278,35 @@ namespace keyinfo
    */
   bool isVorbisComment(unsigned keyID)
   {
-    // no vorbis comments
-    if (keyID == FILENAME) return false;
-    if (keyID == IMAGE)    return false;
+    return (keyID < keyCount) && (keys[keyID].attributes & VORBIS);
+  }
 
-    // most keys are vorbis comments
-    return true;
+  // ----
+  // find
+  // ----
+  /*
+   *
+   */
+  unsigned find(const string& key)
+  {
+    // get slot
+    unsigned i = hash(key.data(), key.size(), table.seed) >> (32 - slotBits);
+
+    // get candidate
+    unsigned k = table.slots[i];
+
+    // empty slot
+    if (k == EMPTY) return keyCount;
+
+    // compare names once
+    if ( (key.size() == keys[k].size)
+    &&   (key.compare(0, keys[k].size, keys[k].name) == 0) )
+    {
+      return k;
+    }
+
+    // key not found
+    return keyCount;
   }
 
   // ---------
@@ -117,18 +317,7 @@ namespace keyinfo
    */
   bool isDefined(const string& key)
   {
-    // search given key
-    for(unsigned i = 0; i < keyCount; i++)
-    {
-      // key found
-      if (key == keys[i])
-      {
-        return true;
-      }
-    }
-
-    // key not found
-    return false;
+    return isDefined( find(key) );
   }
 
   // ----------
@@ -139,19 +328,7 @@ namespace keyinfo
    */
   bool isWritable(const string& key)
   {
-    // search given key
-    for(unsigned i = 0; i < keyCount; i++)
-    {
-      // key found
-      if (key == keys[i])
-      {
-        // call this function
-        return isWritable(i);
-      }
-    }
-
-    // key not found
-    return false;
+    return isWritable( find(key) );
   }
 
   // ---------------
@@ -162,20 +339,7 @@ namespace keyinfo
    */
   bool isVorbisComment(const string& key)
   {
-    // search given key
-    for(unsigned i = 0; i < keyCount; i++)
-    {
-      // key found
-      if (key == keys[i])
-      {
-        // call this function
-        return isVorbisComment(i);
-      }
-    }
-
-    // key not found
-    return false;
+    return isVorbisComment( find(key) );
   }
 
 }
-
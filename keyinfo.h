@@ -19,7 +19,6 @@
 // -----------------------------------------------------------------------------
 // Includes                                                             Includes
 // -----------------------------------------------------------------------------
-#include <vector>
 #include <string>
 
 
@@ -67,19 +66,23 @@ namespace keyinfo
   KEYID;
 
   /// number of keys defined in KEYID
-  extern const unsigned keyCount;
+  constexpr unsigned keyCount = VERSION + 1;
 
-  /// number of characters in the longest key name
-  extern const unsigned maxNameSize;
+  static_assert(keyCount == VERSION + 1, "keyinfo::keyCount must follow the last KEYID");
+
+  /// number of characters in the longest key name (COMPILATIONINDEX)
+  constexpr unsigned maxNameSize = 16;
 
 
   // ----
   // name
   // ----
   /**
+   * @brief  This function returns the name of the given key.
    *
+   * The returned reference points to a static string.
    */
-  string name(unsigned keyID);
+  const string& name(unsigned keyID);
 
   // ---------
   // isDefined
@@ -105,6 +108,15 @@ namespace keyinfo
    */
   bool isVorbisComment(unsigned keyID);
 
+  // ----
+  // find
+  // ----
+  /**
+   * @brief  This function returns the ID of the given key
+   *         (keyCount if the key is not defined).
+   */
+  unsigned find(const string& key);
+
   // ---------
   // isDefined
   // ---------
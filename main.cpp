@@ -23,12 +23,24 @@
 // -----------------------------------------------------------------------------
 // Includes                                                             Includes
 // -----------------------------------------------------------------------------
+#include <mutex>
+#include <atomic>
+#include <memory>
 #include <string>
+#include <vector>
+#include <thread>
 #include <iomanip>
+#include <sstream>
+#include <clocale>
 #include <iostream>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <condition_variable>
 #include "cli.h"
 #include "keyinfo.h"
+#include "message.h"
 #include "scripts.h"
+#include "OutputSink.h"
 #include "KVParser.h"
 #include "TestHandler.h"
 #include "FilterHandler.h"
@@ -37,8 +49,15 @@
 #include "FormatHandler.h"
 #include "UnescapeHandler.h"
 #include "ScriptHandler.h"
+#include "RunHandler.h"
 #include "OverviewHandler.h"
 #include "DBaseHandler.h"
+#include "QueryHandler.h"
+#include "ImportHandler.h"
+#include "HtmlHandler.h"
+#include "CatalogHandler.h"
+#include "ImageHandler.h"
+#include "FlacFile.h"
 
 
 // -----------------------------------------------------------------------------
@@ -47,16 +66,276 @@
 using namespace std;
 
 
+// ----------
+// FileResult
+// ----------
+/**
+ * @brief  The output of one file that has been parsed by a worker thread.
+ */
+struct FileResult
+{
+  /// the file has been parsed
+  bool done;
+
+  /// the value returned by KVParser::parse()
+  bool parsed;
+
+  /// the healthy state of the process chain after parsing
+  bool healthy;
+
+  /// everything the consumer has printed
+  string out;
+
+  /// all messages printed while parsing
+  string err;
+};
+
+// --------------
+// createConsumer
+// --------------
+/**
+ * @brief  This function creates the handler that prints the output
+ *         of the requested operation to the given stream.
+ */
+KVHandler* createConsumer(const cli& cmdl, ostream& out)
+{
+  // options of the tag script
+  unsigned options = cmdl.singlePass ? ScriptHandler::SINGLE_PASS : 0;
+
+  if (cmdl.operation == cli::SHOW_OVERVIEW_BRIEF)   return new OverviewHandler(false, out);
+  if (cmdl.operation == cli::SHOW_OVERVIEW_VERBOSE) return new OverviewHandler(true, out);
+  if (cmdl.operation == cli::SHOW_DBASE_LINES)      return new DBaseHandler(out);
+  if (cmdl.operation == cli::SHOW_PARALLEL_SCRIPT)  return new ScriptHandler(out, options | ScriptHandler::PARALLEL);
+  if (cmdl.operation == cli::SHOW_COMPACT_SCRIPT)   return new ScriptHandler(out, options | ScriptHandler::COMPACT);
+  if (cmdl.operation == cli::SHOW_MAKEFILE)         return new ScriptHandler(out, options | ScriptHandler::MAKEFILE);
+  if (cmdl.operation == cli::RUN_JOBS)              return new RunHandler(cmdl.encoders, options, cmdl.journal, cmdl.cache, cmdl.builtin);
+
+  // default operation
+  return new ScriptHandler(out, options);
+}
+
+// ---------
+// runWorker
+// ---------
+/**
+ * @brief  This function is run by each worker thread. It keeps taking the
+ *         next unparsed file until all files are done.
+ */
+void runWorker( const cli&                  cmdl,
+                const vector<string>&       filenames,
+                vector<FileResult>&         results,
+                atomic<size_t>&             next,
+                const atomic<size_t>&       stop,
+                mutex&                      lock,
+                condition_variable&         ready
+              )
+{
+  // this worker's buffers
+  stringstream out;
+  stringstream err;
+
+  // create consumer
+  unique_ptr<KVHandler> consumer( createConsumer(cmdl, out) );
+
+  // create common process chain
+  UnescapeHandler h5( consumer.get() );
+  FormatHandler   h4(&h5);
+  ReplaceHandler  h3(&h4);
+  StackHandler    h2(&h3);
+  FilterHandler   h1(&h2);
+
+  // create parser
+  KVParser parser;
+  parser.setHandler(&h1);
+
+  // reads the binary images of the files
+  ImageHandler images;
+
+  // collect messages
+  msg::redirect(&err);
+
+  while (true)
+  {
+    // get index of the next file
+    size_t i = next++;
+
+    // all (requested) files done
+    if ( (i >= filenames.size()) || (i > stop) ) break;
+
+    // take tracks from image (resp. parse given file)
+    bool parsed  = images.replay(filenames[i], consumer.get()) || parser.parse(filenames[i]);
+    bool healthy = h1.healthy();
+
+    // publish result
+    {
+      lock_guard<mutex> guard(lock);
+
+      results[i].parsed  = parsed;
+      results[i].healthy = healthy;
+      results[i].out     = out.str();
+      results[i].err     = err.str();
+      results[i].done    = true;
+    }
+
+    // wake up main thread
+    ready.notify_all();
+
+    // reset buffers
+    out.str("");
+    err.str("");
+  }
+
+  // back to stderr
+  msg::redirect(0);
+}
+
+// --------------------
+// createParallelOutput
+// --------------------
+/**
+ * @brief  This function parses the NUL terminated files read from stdin on
+ *         several threads, but prints the output in input order.
+ *
+ * The output is the same as the output of createOutput(). In particular,
+ * no output of the files following the first broken file is printed.
+ */
+bool createParallelOutput(const cli& cmdl)
+{
+  // the number of threads
+  unsigned jobs = cmdl.jobs;
+
+  // the names of all files to parse
+  vector<string> filenames;
+
+  // one filename
+  string buffer;
+
+  // get NUL terminated filenames from stdin
+  while ( getline(cin, buffer, '\0') )
+  {
+    // append filename
+    filenames.push_back(buffer);
+  }
+
+  // don't start more threads than needed
+  if (jobs > filenames.size())
+  {
+    jobs = filenames.size();
+  }
+
+  // shared state
+  vector<FileResult> results( filenames.size(), FileResult() );
+  atomic<size_t>     next(0);
+  atomic<size_t>     stop( filenames.size() );
+  mutex              lock;
+  condition_variable ready;
+
+  // start workers
+  vector<thread> workers;
+
+  for(unsigned n = 0; n < jobs; n++)
+  {
+    workers.push_back( thread( runWorker,
+                               cref(cmdl),
+                               cref(filenames),
+                               ref(results),
+                               ref(next),
+                               cref(stop),
+                               ref(lock),
+                               ref(ready) ) );
+  }
+
+  // the final state
+  bool healthy = true;
+
+  // buffered stdout
+  OutputSink sink(STDOUT_FILENO);
+  ostream    out(&sink);
+
+  // print results in input order
+  for(size_t i = 0; i < results.size(); i++)
+  {
+    FileResult result;
+
+    // wait for the current file
+    {
+      unique_lock<mutex> guard(lock);
+
+      ready.wait(guard, [&]{ return results[i].done; });
+
+      // take result
+      result = results[i];
+
+      // release memory
+      results[i].out.clear();
+      results[i].err.clear();
+    }
+
+    // print output
+    out << result.out;
+    sink.flush();
+    cerr << result.err << flush;
+
+    // get healthy state
+    healthy = result.healthy;
+
+    // unable to parse current file
+    if ( !result.parsed )
+    {
+      // don't start any further files
+      stop = i;
+
+      // signalize trouble
+      healthy = false;
+
+      // exit loop
+      break;
+    }
+  }
+
+  // wait for all workers
+  for(size_t n = 0; n < workers.size(); n++)
+  {
+    workers[n].join();
+  }
+
+  // check output
+  if ( !sink.close() )
+  {
+    // notify user
+    msg::err("unable to write output");
+
+    // signalize trouble
+    return false;
+  }
+
+  // return final state
+  return healthy;
+}
+
 // ------------
 // createOutput
 // ------------
 /**
+ * @brief  This function parses the given file (or the NUL terminated files
+ *         read from stdin) and prints the output of the requested operation.
  *
+ * The output is buffered and written once per file.
  */
-bool createOutput(KVHandler& consumer, const string& filename)
+bool createOutput(const cli& cmdl)
 {
+  // the file to parse
+  const string& filename = cmdl.filename;
+
+  // buffered stdout
+  OutputSink sink(STDOUT_FILENO);
+  ostream    out(&sink);
+
+  // create consumer
+  unique_ptr<KVHandler> consumer( createConsumer(cmdl, out) );
+
   // create common process chain
-  UnescapeHandler h5(&consumer);
+  UnescapeHandler h5( consumer.get() );
   FormatHandler   h4(&h5);
   ReplaceHandler  h3(&h4);
   StackHandler    h2(&h3);
@@ -66,61 +345,51 @@ bool createOutput(KVHandler& consumer, const string& filename)
   KVParser parser;
   parser.setHandler(&h1);
 
+  // reads the binary images of the files
+  ImageHandler images;
+
+  // the value returned by KVParser::parse()
+  bool parsed = true;
+
   // no filename given (read from stdin)
   if ( filename.empty() )
   {
-    // one byte from stdin
-    char c;
-
-    // buffer of characters
+    // one filename
     string buffer;
 
-    // get characters from stdin
-    while( cin.get(c) )
+    // get NUL terminated filenames from stdin
+    while ( getline(cin, buffer, '\0') )
     {
-      // delimiter found
-      if (c == 0)
-      {
-        // parse given file
-        if ( !parser.parse(buffer) )
-        {
-          return false;
-        }
-
-        // reset buffer
-        buffer = "";
-      }
+      // take tracks from image (resp. parse given file)
+      parsed = images.replay(buffer, consumer.get()) || parser.parse(buffer);
 
-      else
-      {
-        // append character
-        buffer += c;
-      }
-    }
+      // write output of this file
+      sink.flush();
 
-    // check last filename
-    if ( !buffer.empty() )
-    {
-      // parse given file
-      if ( !parser.parse(buffer) )
-      {
-        return false;
-      }
+      // stop at broken file
+      if ( !parsed ) break;
     }
   }
 
   // use given filename
   else
   {
-    // parse given file
-    if ( !parser.parse(filename) )
-    {
-      return false;
-    }
+    // take tracks from image (resp. parse given file)
+    parsed = images.replay(filename, consumer.get()) || parser.parse(filename);
+  }
+
+  // check output
+  if ( !sink.close() )
+  {
+    // notify user
+    msg::err("unable to write output");
+
+    // signalize trouble
+    return false;
   }
 
   // get healthy state
-  return h1.healthy();
+  return parsed && h1.healthy();
 }
 
 // -------------
@@ -129,13 +398,82 @@ bool createOutput(KVHandler& consumer, const string& filename)
 /**
  *
  */
-bool showTagScript(const string& filename)
+bool showTagScript(const cli& cmdl)
+{
+  // parse several files at once
+  if (cmdl.jobs > 1)
+  {
+    return createParallelOutput(cmdl);
+  }
+
+  // run operation
+  return createOutput(cmdl);
+}
+
+// ------------------
+// showParallelScript
+// ------------------
+/**
+ *
+ */
+bool showParallelScript(const cli& cmdl)
 {
-  // define output format
-  ScriptHandler consumer;
+  // parse several files at once
+  if (cmdl.jobs > 1)
+  {
+    return createParallelOutput(cmdl);
+  }
 
   // run operation
-  return createOutput(consumer, filename);
+  return createOutput(cmdl);
+}
+
+// -----------------
+// showCompactScript
+// -----------------
+/**
+ *
+ */
+bool showCompactScript(const cli& cmdl)
+{
+  // parse several files at once
+  if (cmdl.jobs > 1)
+  {
+    return createParallelOutput(cmdl);
+  }
+
+  // run operation
+  return createOutput(cmdl);
+}
+
+// ------------
+// showMakefile
+// ------------
+/**
+ *
+ */
+bool showMakefile(const cli& cmdl)
+{
+  // parse several files at once
+  if (cmdl.jobs > 1)
+  {
+    return createParallelOutput(cmdl);
+  }
+
+  // run operation
+  return createOutput(cmdl);
+}
+
+// -------
+// runJobs
+// -------
+/**
+ *
+ */
+bool runJobs(const cli& cmdl)
+{
+  // run operation
+  return createOutput(cmdl);
 }
 
 // -----------------
@@ -144,13 +482,16 @@ bool showTagScript(const string& filename)
 /**
  *
  */
-bool showBriefOverview(const string& filename)
+bool showBriefOverview(const cli& cmdl)
 {
-  // define output format
-  OverviewHandler consumer;
+  // parse several files at once
+  if (cmdl.jobs > 1)
+  {
+    return createParallelOutput(cmdl);
+  }
 
   // run operation
-  return createOutput(consumer, filename);
+  return createOutput(cmdl);
 }
 
 // -------------------
@@ -159,13 +500,328 @@ bool showBriefOverview(const string& filename)
 /**
  *
  */
-bool showVerboseOverview(const string& filename)
+bool showVerboseOverview(const cli& cmdl)
 {
-  // define output format
-  OverviewHandler consumer(true);
+  // parse several files at once
+  if (cmdl.jobs > 1)
+  {
+    return createParallelOutput(cmdl);
+  }
 
   // run operation
-  return createOutput(consumer, filename);
+  return createOutput(cmdl);
+}
+
+// -------------
+// readFilenames
+// -------------
+/**
+ * @brief  This function returns the given filename (resp. the NUL
+ *         terminated filenames read from stdin).
+ */
+vector<string> readFilenames(const cli& cmdl)
+{
+  // the names of all files
+  vector<string> filenames;
+
+  // get NUL terminated filenames from stdin
+  if (cmdl.source == cli::STDIN)
+  {
+    // one filename
+    string buffer;
+
+    while ( getline(cin, buffer, '\0') )
+    {
+      filenames.push_back(buffer);
+    }
+  }
+
+  // use given filename
+  else
+  {
+    filenames.push_back(cmdl.filename);
+  }
+
+  // return filenames
+  return filenames;
+}
+
+// ------------
+// showFlacTags
+// ------------
+/**
+ * @brief  This function shows the first of the given comments found in
+ *         each flac file.
+ *
+ * Filenames read from stdin are printed along with their values
+ * ("<filename>\0<value>\0"), a given filename is not ("<value>\n").
+ */
+bool showFlacTags(const cli& cmdl)
+{
+  // buffered stdout
+  OutputSink sink(STDOUT_FILENO);
+  ostream    out(&sink);
+
+  // all files could be read
+  bool healthy = true;
+
+  // the names of all files
+  vector<string> filenames = readFilenames(cmdl);
+
+  for(unsigned i = 0; i < filenames.size(); i++)
+  {
+    // the value found
+    string value;
+
+    // read metadata
+    FlacFile file;
+    if ( file.load(filenames[i]) )
+    {
+      // get the first comment found
+      for(unsigned k = 0; k < cmdl.flacKeys.size(); k++)
+      {
+        if ( file.value(cmdl.flacKeys[k], value) ) break;
+      }
+    }
+
+    else
+    {
+      // update healthy flag
+      healthy = false;
+    }
+
+    // show value
+    if (cmdl.source == cli::STDIN)
+    {
+      out << filenames[i] << '\0' << value << '\0';
+    }
+
+    else
+    {
+      out << value << '\n';
+    }
+  }
+
+  // check output
+  if ( !sink.close() )
+  {
+    // notify user
+    msg::err("unable to write output");
+
+    // signalize trouble
+    return false;
+  }
+
+  // return final state
+  return healthy;
+}
+
+// --------------
+// updateFlacTags
+// --------------
+/**
+ * @brief  This function replaces the comments of the given name in each
+ *         flac file and shows the resulting comments.
+ */
+bool updateFlacTags(const cli& cmdl)
+{
+  // buffered stdout
+  OutputSink sink(STDOUT_FILENO);
+  ostream    out(&sink);
+
+  // all files could be updated
+  bool healthy = true;
+
+  // split comment
+  string::size_type pos = cmdl.flacTag.find('=');
+  string name  = cmdl.flacTag.substr(0, pos);
+  string value = cmdl.flacTag.substr(pos + 1);
+
+  // the names of all files
+  vector<string> filenames = readFilenames(cmdl);
+
+  for(unsigned i = 0; i < filenames.size(); i++)
+  {
+    // skip empty files
+    struct stat info;
+    if ( (stat(filenames[i].c_str(), &info) == 0) && (info.st_size == 0) )
+    {
+      // notify user
+      sink.flush();
+      msg::wrn( msg::catq("skipping file (empty file): ", filenames[i]) );
+
+      // next file
+      continue;
+    }
+
+    // skip files without write permission
+    if ( (stat(filenames[i].c_str(), &info) == 0) && (access(filenames[i].c_str(), W_OK) != 0) )
+    {
+      // notify user
+      sink.flush();
+      msg::wrn( msg::catq("skipping file (no write permission): ", filenames[i]) );
+
+      // next file
+      continue;
+    }
+
+    // read metadata
+    FlacFile file;
+    sink.flush();
+    if ( !file.load(filenames[i]) )
+    {
+      // update healthy flag
+      healthy = false;
+
+      // next file
+      continue;
+    }
+
+    // replace comments
+    file.removeTag(name);
+    file.addTag(name, value);
+
+    // write metadata
+    if ( !file.save() )
+    {
+      // update healthy flag
+      healthy = false;
+
+      // next file
+      continue;
+    }
+
+    // show comments
+    out << filenames[i] << '\n';
+    for(unsigned k = 0; k < file.comments().size(); k++)
+    {
+      out << "  " << file.comments()[k] << '\n';
+    }
+    out << '\n';
+  }
+
+  // check output
+  if ( !sink.close() )
+  {
+    // notify user
+    msg::err("unable to write output");
+
+    // signalize trouble
+    return false;
+  }
+
+  // return final state
+  return healthy;
+}
+
+// ----------
+// parseFiles
+// ----------
+/**
+ * @brief  This function passes the tracks of the given file (resp. the
+ *         NUL terminated files read from stdin) to the given consumer.
+ *
+ * @return  false if a file is broken (the following files are skipped)
+ */
+bool parseFiles(const cli& cmdl, KVHandler* consumer)
+{
+  // records the tracks of all files (option -D)
+  bool           cached = !cmdl.catalog.empty();
+  CatalogHandler catalog(consumer);
+
+  // create common process chain
+  UnescapeHandler h5( cached ? &catalog : consumer );
+  FormatHandler   h4(&h5);
+  ReplaceHandler  h3(&h4);
+  StackHandler    h2(&h3);
+  FilterHandler   h1(&h2);
+
+  // create parser
+  KVParser parser;
+  parser.setHandler(&h1);
+
+  // read catalog
+  if ( cached && !catalog.load(cmdl.catalog) ) return false;
+
+  // reads the binary images of the files
+  ImageHandler images;
+
+  // parse all files
+  vector<string> filenames = readFilenames(cmdl);
+  for(size_t i = 0; i < filenames.size(); i++)
+  {
+    // take tracks of unchanged file from catalog
+    if ( cached && catalog.replay(filenames[i]) )
+    {
+      // stop at failing consumer
+      if ( !consumer->healthy() ) return false;
+
+      // next file
+      continue;
+    }
+
+    // take tracks from image
+    if ( images.replay(filenames[i], cached ? &catalog : consumer) )
+    {
+      // stop at failing consumer
+      if ( !consumer->healthy() ) return false;
+
+      // next file
+      continue;
+    }
+
+    // stop at broken file
+    if ( !parser.parse(filenames[i]) || !h1.healthy() )
+    {
+      // keep the files parsed so far
+      if (cached)
+      {
+        catalog.remove(filenames[i]);
+        catalog.save();
+      }
+
+      // signalize trouble
+      return false;
+    }
+  }
+
+  // write catalog
+  if ( cached && !catalog.save() ) return false;
+
+  // signalize success
+  return true;
+}
+
+// ----------------
+// showCatalogLines
+// ----------------
+/**
+ * @brief  This function prints the database lines of the given file
+ *         (resp. the NUL terminated files read from stdin), taking the
+ *         tracks of unchanged files from the catalog (option -D).
+ */
+bool showCatalogLines(const cli& cmdl)
+{
+  // buffered stdout
+  OutputSink sink(STDOUT_FILENO);
+  ostream    out(&sink);
+
+  // print lines
+  DBaseHandler consumer(out);
+  bool healthy = parseFiles(cmdl, &consumer);
+
+  // check output
+  if ( !sink.close() )
+  {
+    // notify user
+    msg::err("unable to write output");
+
+    // signalize trouble
+    return false;
+  }
+
+  // return final state
+  return healthy;
 }
 
 // --------------
@@ -174,13 +830,282 @@ bool showVerboseOverview(const string& filename)
 /**
  *
  */
-bool showDBaseLines(const string& filename)
+bool showDBaseLines(const cli& cmdl)
 {
-  // define output format
-  DBaseHandler consumer;
+  // take tracks from catalog
+  if ( !cmdl.catalog.empty() )
+  {
+    return showCatalogLines(cmdl);
+  }
+
+  // parse several files at once
+  if (cmdl.jobs > 1)
+  {
+    return createParallelOutput(cmdl);
+  }
 
   // run operation
-  return createOutput(consumer, filename);
+  return createOutput(cmdl);
+}
+
+// --------
+// runQuery
+// --------
+/**
+ * @brief  This function prints the requested keys of all tracks of the
+ *         given file (resp. the NUL terminated files read from stdin).
+ *
+ * Nothing is printed if a file is broken.
+ */
+bool runQuery(const cli& cmdl)
+{
+  // buffered stdout
+  OutputSink sink(STDOUT_FILENO);
+  ostream    out(&sink);
+
+  // collect rows
+  QueryHandler consumer(cmdl.queryKeys, cmdl.distinct, out);
+  if ( !parseFiles(cmdl, &consumer) ) return false;
+
+  // use collation of the user's locale
+  if (cmdl.collate)
+  {
+    setlocale(LC_COLLATE, "");
+  }
+
+  // print rows
+  consumer.print(cmdl.sortColumns, cmdl.collate);
+
+  // check output
+  if ( !sink.close() )
+  {
+    // notify user
+    msg::err("unable to write output");
+
+    // signalize trouble
+    return false;
+  }
+
+  // signalize success
+  return true;
+}
+
+// ----------------
+// writeImportFiles
+// ----------------
+/**
+ * @brief  This function writes one importable file per person (resp.
+ *         opus) of all tracks of the given file (resp. the NUL terminated
+ *         files read from stdin).
+ *
+ * Nothing is written if a file is broken.
+ */
+bool writeImportFiles(const cli& cmdl)
+{
+  // collect values
+  ImportHandler consumer;
+  if ( !parseFiles(cmdl, &consumer) ) return false;
+
+  // write files
+  return consumer.write(cmdl.importDir);
+}
+
+// -------------
+// runHtmlWorker
+// -------------
+/**
+ * @brief  This function is run by each worker thread of writeHtmlIndex().
+ *         It keeps taking the next unparsed file until all files are done
+ *         (resp. a file is broken).
+ */
+void runHtmlWorker( const vector<string>&               filenames,
+                    vector< vector< vector<string> > >& rows,
+                    atomic<size_t>&                     next,
+                    atomic<bool>&                       failed,
+                    mutex&                              lock
+                  )
+{
+  // this worker's messages
+  stringstream err;
+
+  // create consumer
+  HtmlHandler consumer;
+
+  // create common process chain
+  UnescapeHandler h5(&consumer);
+  FormatHandler   h4(&h5);
+  ReplaceHandler  h3(&h4);
+  StackHandler    h2(&h3);
+  FilterHandler   h1(&h2);
+
+  // create parser
+  KVParser parser;
+  parser.setHandler(&h1);
+
+  // collect messages
+  msg::redirect(&err);
+
+  while ( !failed )
+  {
+    // get index of the next file
+    size_t i = next++;
+
+    // all files done
+    if (i >= filenames.size()) break;
+
+    // parse given file
+    if ( !parser.parse(filenames[i]) || !h1.healthy() )
+    {
+      // don't start any further files
+      failed = true;
+    }
+
+    // keep albums of this file
+    consumer.moveRows(rows[i]);
+
+    // print messages of this file
+    {
+      lock_guard<mutex> guard(lock);
+
+      cerr << err.str() << flush;
+    }
+
+    // reset buffer
+    err.str("");
+  }
+
+  // back to stderr
+  msg::redirect(0);
+}
+
+// --------------
+// writeHtmlIndex
+// --------------
+/**
+ * @brief  This function writes the html page of each given file (resp.
+ *         each NUL terminated file read from stdin) and the html index of
+ *         all albums.
+ *
+ * The files are parsed on several threads (option -j) unless a catalog
+ * is used (option -D). Pages are only written if they are outdated, the
+ * index is always written (but not if a file is broken).
+ */
+bool writeHtmlIndex(const cli& cmdl)
+{
+  // take tracks from catalog (one thread)
+  if ( !cmdl.catalog.empty() )
+  {
+    // write pages and collect albums
+    HtmlHandler consumer;
+    if ( !parseFiles(cmdl, &consumer) ) return false;
+
+    // get albums in input order
+    vector< vector<string> > albums;
+    consumer.moveRows(albums);
+
+    // use collation of the user's locale
+    setlocale(LC_COLLATE, "");
+
+    // write index
+    return HtmlHandler::writeIndex(cmdl.htmlIndex, albums);
+  }
+
+  // the names of all files to parse
+  vector<string> filenames = readFilenames(cmdl);
+
+  // the number of threads
+  unsigned jobs = cmdl.jobs;
+
+  // don't start more threads than needed
+  if (jobs > filenames.size())
+  {
+    jobs = filenames.size();
+  }
+
+  // shared state
+  vector< vector< vector<string> > > rows( filenames.size() );
+  atomic<size_t>                     next(0);
+  atomic<bool>                       failed(false);
+  mutex                              lock;
+
+  // start workers
+  vector<thread> workers;
+
+  for(unsigned n = 0; n < jobs; n++)
+  {
+    workers.push_back( thread( runHtmlWorker,
+                               cref(filenames),
+                               ref(rows),
+                               ref(next),
+                               ref(failed),
+                               ref(lock) ) );
+  }
+
+  // wait for all workers
+  for(size_t n = 0; n < workers.size(); n++)
+  {
+    workers[n].join();
+  }
+
+  // broken file
+  if (failed) return false;
+
+  // get albums in input order
+  vector< vector<string> > albums;
+  for(size_t i = 0; i < rows.size(); i++)
+  {
+    for(size_t k = 0; k < rows[i].size(); k++)
+    {
+      albums.push_back( vector<string>() );
+      albums.back().swap(rows[i][k]);
+    }
+  }
+
+  // use collation of the user's locale
+  setlocale(LC_COLLATE, "");
+
+  // write index
+  return HtmlHandler::writeIndex(cmdl.htmlIndex, albums);
+}
+
+// -------------
+// compileImages
+// -------------
+/**
+ * @brief  This function writes the binary image of the given file (resp.
+ *         of each NUL terminated file read from stdin).
+ *
+ * The images of all files before a broken file are written.
+ */
+bool compileImages(const cli& cmdl)
+{
+  // collects the tracks of each file
+  ImageHandler consumer;
+
+  // create common process chain
+  UnescapeHandler h5(&consumer);
+  FormatHandler   h4(&h5);
+  ReplaceHandler  h3(&h4);
+  StackHandler    h2(&h3);
+  FilterHandler   h1(&h2);
+
+  // create parser
+  KVParser parser;
+  parser.setHandler(&h1);
+
+  // compile all files
+  vector<string> filenames = readFilenames(cmdl);
+  for(size_t i = 0; i < filenames.size(); i++)
+  {
+    // stop at broken file (no image is written)
+    if ( !parser.parse(filenames[i]) || !h1.healthy() ) return false;
+
+    // write image
+    if ( !consumer.commit() ) return false;
+  }
+
+  // signalize success
+  return true;
 }
 
 // --------------
@@ -266,7 +1191,7 @@ int main(int argc, char** argv)
   if (cmdl.operation == cli::DEFAULT)
   {
     // show tag script
-    if ( !showTagScript(cmdl.filename) )
+    if ( !showTagScript(cmdl) )
     {
       // signalize trouble
       return 1;
@@ -279,7 +1204,7 @@ int main(int argc, char** argv)
     // show brief overview
     if (cmdl.operation == cli::SHOW_OVERVIEW_BRIEF)
     {
-      if ( !showBriefOverview(cmdl.filename) )
+      if ( !showBriefOverview(cmdl) )
       {
         // signalize trouble
         return 1;
@@ -289,7 +1214,7 @@ int main(int argc, char** argv)
     // show verbose overview
     else if (cmdl.operation == cli::SHOW_OVERVIEW_VERBOSE)
     {
-      if ( !showVerboseOverview(cmdl.filename) )
+      if ( !showVerboseOverview(cmdl) )
       {
         // signalize trouble
         return 1;
@@ -299,7 +1224,107 @@ int main(int argc, char** argv)
     // show database lines
     else if (cmdl.operation == cli::SHOW_DBASE_LINES)
     {
-      if ( !showDBaseLines(cmdl.filename) )
+      if ( !showDBaseLines(cmdl) )
+      {
+        // signalize trouble
+        return 1;
+      }
+    }
+
+    // show parallel tag script
+    else if (cmdl.operation == cli::SHOW_PARALLEL_SCRIPT)
+    {
+      if ( !showParallelScript(cmdl) )
+      {
+        // signalize trouble
+        return 1;
+      }
+    }
+
+    // show compact tag script
+    else if (cmdl.operation == cli::SHOW_COMPACT_SCRIPT)
+    {
+      if ( !showCompactScript(cmdl) )
+      {
+        // signalize trouble
+        return 1;
+      }
+    }
+
+    // show makefile
+    else if (cmdl.operation == cli::SHOW_MAKEFILE)
+    {
+      if ( !showMakefile(cmdl) )
+      {
+        // signalize trouble
+        return 1;
+      }
+    }
+
+    // encode and tag tracks
+    else if (cmdl.operation == cli::RUN_JOBS)
+    {
+      if ( !runJobs(cmdl) )
+      {
+        // signalize trouble
+        return 1;
+      }
+    }
+
+    // print keys of all tracks
+    else if (cmdl.operation == cli::RUN_QUERY)
+    {
+      if ( !runQuery(cmdl) )
+      {
+        // signalize trouble
+        return 1;
+      }
+    }
+
+    // write importable files
+    else if (cmdl.operation == cli::WRITE_IMPORT_FILES)
+    {
+      if ( !writeImportFiles(cmdl) )
+      {
+        // signalize trouble
+        return 1;
+      }
+    }
+
+    // write html pages and index
+    else if (cmdl.operation == cli::WRITE_HTML_INDEX)
+    {
+      if ( !writeHtmlIndex(cmdl) )
+      {
+        // signalize trouble
+        return 1;
+      }
+    }
+
+    // compile files
+    else if (cmdl.operation == cli::COMPILE_IMAGES)
+    {
+      if ( !compileImages(cmdl) )
+      {
+        // signalize trouble
+        return 1;
+      }
+    }
+
+    // show comments of flac files
+    else if (cmdl.operation == cli::SHOW_FLAC_TAGS)
+    {
+      if ( !showFlacTags(cmdl) )
+      {
+        // signalize trouble
+        return 1;
+      }
+    }
+
+    // replace comments of flac files
+    else if (cmdl.operation == cli::UPDATE_FLAC_TAGS)
+    {
+      if ( !updateFlacTags(cmdl) )
       {
         // signalize trouble
         return 1;
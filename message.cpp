@@ -29,6 +29,20 @@ using namespace std;
 namespace msg
 {
 
+  /// the stream that receives the messages of the current thread
+  thread_local ostream* target = 0;
+
+  // ------
+  // stream
+  // ------
+  /*
+   * stderr or redirected stream
+   */
+  ostream& stream()
+  {
+    return (target == 0) ? cerr : *target;
+  }
+
   // ---
   // nfo
   // ---
@@ -38,7 +52,7 @@ namespace msg
   void nfo(const string& message)
   {
     // show info
-    cerr << "\033[34m" << "[INFO]" << "\033[0m" << " " << message << endl;
+    stream() << "\033[34m" << "[INFO]" << "\033[0m" << " " << message << endl;
   }
 
   // ---
@@ -50,7 +64,7 @@ namespace msg
   void wrn(const string& message)
   {
     // show warning
-    cerr << "\033[33m" << "[WARN]" << "\033[0m" << " " << message << endl;
+    stream() << "\033[33m" << "[WARN]" << "\033[0m" << " " << message << endl;
   }
 
   // ---
@@ -62,7 +76,18 @@ namespace msg
   void err(const string& message)
   {
     // show error
-    cerr << "\033[31m" << "[FAIL]" << "\033[0m" << " " << message << endl;
+    stream() << "\033[31m" << "[FAIL]" << "\033[0m" << " " << message << endl;
+  }
+
+  // --------
+  // redirect
+  // --------
+  /*
+   *
+   */
+  void redirect(ostream* stream)
+  {
+    target = stream;
   }
 
   // ---
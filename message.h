@@ -20,6 +20,7 @@
 // Includes                                                             Includes
 // -----------------------------------------------------------------------------
 #include <string>
+#include <iosfwd>
 
 
 // ---
@@ -34,6 +35,7 @@
  *   - msg::nfo()
  *   - msg::wrn()
  *   - msg::err()
+ *   - msg::redirect()
  * * Concatenation
  *   - msg::cat()
  *   - msg::catq()
@@ -102,6 +104,25 @@ namespace msg
    */
   void err(const std::string& message);
 
+  // --------
+  // redirect
+  // --------
+  /**
+   * @brief  This function redirects the messages printed by the
+   *         calling thread.
+   *
+   * Worker threads use this function to collect their messages,
+   * so these can be shown in the order of the processed files.
+   *
+   * @param stream  holds the stream to use instead of stderr
+   *                (0 switches back to stderr).
+   *
+   * @see  msg::nfo()
+   * @see  msg::wrn()
+   * @see  msg::err()
+   */
+  void redirect(std::ostream* stream);
+
   // ---
   // cat
   // ---
@@ -0,0 +1,1184 @@
+// -----------------------------------------------------------------------------
+// translit.cpp                                                     translit.cpp
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file defines all members of the @ref translit namespace.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include "translit.h"
+
+
+// -----------------------------------------------------------------------------
+// Used namespaces                                               Used namespaces
+// -----------------------------------------------------------------------------
+using namespace std;
+
+
+// -----------------------------------------------------------------------------
+// Definitions                                                       Definitions
+// -----------------------------------------------------------------------------
+namespace translit
+{
+
+  // -------
+  // Mapping
+  // -------
+  /**
+   * @brief  The transliteration of one code point.
+   */
+  struct Mapping
+  {
+    /// the unicode number
+    unsigned code;
+
+    /// the ascii replacement (1 to 3 characters)
+    const char* text;
+  };
+
+  /// all transliterations (sorted by code point)
+  constexpr Mapping mappings[] =
+  {
+    // Basic Latin (U+0000 to U+007F)
+    {    '$', "usd" },
+    {    '0', "0"   },
+    {    '1', "1"   },
+    {    '2', "2"   },
+    {    '3', "3"   },
+    {    '4', "4"   },
+    {    '5', "5"   },
+    {    '6', "6"   },
+    {    '7', "7"   },
+    {    '8', "8"   },
+    {    '9', "9"   },
+    {    'A', "a"   },
+    {    'B', "b"   },
+    {    'C', "c"   },
+    {    'D', "d"   },
+    {    'E', "e"   },
+    {    'F', "f"   },
+    {    'G', "g"   },
+    {    'H', "h"   },
+    {    'I', "i"   },
+    {    'J', "j"   },
+    {    'K', "k"   },
+    {    'L', "l"   },
+    {    'M', "m"   },
+    {    'N', "n"   },
+    {    'O', "o"   },
+    {    'P', "p"   },
+    {    'Q', "q"   },
+    {    'R', "r"   },
+    {    'S', "s"   },
+    {    'T', "t"   },
+    {    'U', "u"   },
+    {    'V', "v"   },
+    {    'W', "w"   },
+    {    'X', "x"   },
+    {    'Y', "y"   },
+    {    'Z', "z"   },
+    {    'a', "a"   },
+    {    'b', "b"   },
+    {    'c', "c"   },
+    {    'd', "d"   },
+    {    'e', "e"   },
+    {    'f', "f"   },
+    {    'g', "g"   },
+    {    'h', "h"   },
+    {    'i', "i"   },
+    {    'j', "j"   },
+    {    'k', "k"   },
+    {    'l', "l"   },
+    {    'm', "m"   },
+    {    'n', "n"   },
+    {    'o', "o"   },
+    {    'p', "p"   },
+    {    'q', "q"   },
+    {    'r', "r"   },
+    {    's', "s"   },
+    {    't', "t"   },
+    {    'u', "u"   },
+    {    'v', "v"   },
+    {    'w', "w"   },
+    {    'x', "x"   },
+    {    'y', "y"   },
+    {    'z', "z"   },
+
+    // Latin-1 Supplement (U+0080 to U+00FF)
+    { 0x00a2, "ct"  }, //   162: ¢
+    { 0x00a3, "gbp" }, //   163: £
+    { 0x00a5, "jpy" }, //   165: ¥
+    { 0x00a9, "c"   }, //   169: ©
+    { 0x00aa, "a"   }, //   170: ª
+    { 0x00ae, "r"   }, //   174: ®
+    { 0x00b2, "2"   }, //   178: ²
+    { 0x00b3, "3"   }, //   179: ³
+    { 0x00b5, "mu"  }, //   181: µ
+    { 0x00b9, "1"   }, //   185: ¹
+    { 0x00ba, "o"   }, //   186: º
+    { 0x00c0, "a"   }, //   192: À
+    { 0x00c1, "a"   }, //   193: Á
+    { 0x00c2, "a"   }, //   194: Â
+    { 0x00c3, "a"   }, //   195: Ã
+    { 0x00c4, "ae"  }, //   196: Ä
+    { 0x00c5, "a"   }, //   197: Å
+    { 0x00c6, "ae"  }, //   198: Æ
+    { 0x00c7, "c"   }, //   199: Ç
+    { 0x00c8, "e"   }, //   200: È
+    { 0x00c9, "e"   }, //   201: É
+    { 0x00ca, "e"   }, //   202: Ê
+    { 0x00cb, "e"   }, //   203: Ë
+    { 0x00cc, "i"   }, //   204: Ì
+    { 0x00cd, "i"   }, //   205: Í
+    { 0x00ce, "i"   }, //   206: Î
+    { 0x00cf, "i"   }, //   207: Ï
+    { 0x00d0, "dh"  }, //   208: Ð
+    { 0x00d1, "n"   }, //   209: Ñ
+    { 0x00d2, "o"   }, //   210: Ò
+    { 0x00d3, "o"   }, //   211: Ó
+    { 0x00d4, "o"   }, //   212: Ô
+    { 0x00d5, "o"   }, //   213: Õ
+    { 0x00d6, "oe"  }, //   214: Ö
+    { 0x00d8, "oe"  }, //   216: Ø
+    { 0x00d9, "u"   }, //   217: Ù
+    { 0x00da, "u"   }, //   218: Ú
+    { 0x00db, "u"   }, //   219: Û
+    { 0x00dc, "ue"  }, //   220: Ü
+    { 0x00dd, "y"   }, //   221: Ý
+    { 0x00de, "th"  }, //   222: Þ
+    { 0x00df, "ss"  }, //   223: ß
+    { 0x00e0, "a"   }, //   224: à
+    { 0x00e1, "a"   }, //   225: á
+    { 0x00e2, "a"   }, //   226: â
+    { 0x00e3, "a"   }, //   227: ã
+    { 0x00e4, "ae"  }, //   228: ä
+    { 0x00e5, "a"   }, //   229: å
+    { 0x00e6, "ae"  }, //   230: æ
+    { 0x00e7, "c"   }, //   231: ç
+    { 0x00e8, "e"   }, //   232: è
+    { 0x00e9, "e"   }, //   233: é
+    { 0x00ea, "e"   }, //   234: ê
+    { 0x00eb, "e"   }, //   235: ë
+    { 0x00ec, "i"   }, //   236: ì
+    { 0x00ed, "i"   }, //   237: í
+    { 0x00ee, "i"   }, //   238: î
+    { 0x00ef, "i"   }, //   239: ï
+    { 0x00f0, "dh"  }, //   240: ð
+    { 0x00f1, "n"   }, //   241: ñ
+    { 0x00f2, "o"   }, //   242: ò
+    { 0x00f3, "o"   }, //   243: ó
+    { 0x00f4, "o"   }, //   244: ô
+    { 0x00f5, "o"   }, //   245: õ
+    { 0x00f6, "oe"  }, //   246: ö
+    { 0x00f8, "oe"  }, //   248: ø
+    { 0x00f9, "u"   }, //   249: ù
+    { 0x00fa, "u"   }, //   250: ú
+    { 0x00fb, "u"   }, //   251: û
+    { 0x00fc, "ue"  }, //   252: ü
+    { 0x00fd, "y"   }, //   253: ý
+    { 0x00fe, "th"  }, //   254: þ
+    { 0x00ff, "y"   }, //   255: ÿ
+
+    // Latin Extended-A
+    { 0x0100, "a"   }, //   256: Ā
+    { 0x0101, "a"   }, //   257: ā
+    { 0x0102, "a"   }, //   258: Ă
+    { 0x0103, "a"   }, //   259: ă
+    { 0x0104, "a"   }, //   260: Ą
+    { 0x0105, "a"   }, //   261: ą
+    { 0x0106, "c"   }, //   262: Ć
+    { 0x0107, "c"   }, //   263: ć
+    { 0x0108, "c"   }, //   264: Ĉ
+    { 0x0109, "c"   }, //   265: ĉ
+    { 0x010a, "c"   }, //   266: Ċ
+    { 0x010b, "c"   }, //   267: ċ
+    { 0x010c, "c"   }, //   268: Č
+    { 0x010d, "c"   }, //   269: č
+    { 0x010e, "d"   }, //   270: Ď
+    { 0x010f, "d"   }, //   271: ď
+    { 0x0110, "d"   }, //   272: Đ
+    { 0x0111, "d"   }, //   273: đ
+    { 0x0112, "e"   }, //   274: Ē
+    { 0x0113, "e"   }, //   275: ē
+    { 0x0114, "e"   }, //   276: Ĕ
+    { 0x0115, "e"   }, //   277: ĕ
+    { 0x0116, "e"   }, //   278: Ė
+    { 0x0117, "e"   }, //   279: ė
+    { 0x0118, "e"   }, //   280: Ę
+    { 0x0119, "e"   }, //   281: ę
+    { 0x011a, "e"   }, //   282: Ě
+    { 0x011b, "e"   }, //   283: ě
+    { 0x011c, "g"   }, //   284: Ĝ
+    { 0x011d, "g"   }, //   285: ĝ
+    { 0x011e, "g"   }, //   286: Ğ
+    { 0x011f, "g"   }, //   287: ğ
+    { 0x0120, "g"   }, //   288: Ġ
+    { 0x0121, "g"   }, //   289: ġ
+    { 0x0122, "g"   }, //   290: Ģ
+    { 0x0123, "g"   }, //   291: ģ
+    { 0x0124, "h"   }, //   292: Ĥ
+    { 0x0125, "h"   }, //   293: ĥ
+    { 0x0126, "h"   }, //   294: Ħ
+    { 0x0127, "h"   }, //   295: ħ
+    { 0x0128, "i"   }, //   296: Ĩ
+    { 0x0129, "i"   }, //   297: ĩ
+    { 0x012a, "i"   }, //   298: Ī
+    { 0x012b, "i"   }, //   299: ī
+    { 0x012c, "i"   }, //   300: Ĭ
+    { 0x012d, "i"   }, //   301: ĭ
+    { 0x012e, "i"   }, //   302: Į
+    { 0x012f, "i"   }, //   303: į
+    { 0x0130, "i"   }, //   304: İ
+    { 0x0131, "i"   }, //   305: ı
+    { 0x0132, "ij"  }, //   306: Ĳ
+    { 0x0133, "ij"  }, //   307: ĳ
+    { 0x0134, "j"   }, //   308: Ĵ
+    { 0x0135, "j"   }, //   309: ĵ
+    { 0x0136, "k"   }, //   310: Ķ
+    { 0x0137, "k"   }, //   311: ķ
+    { 0x0138, "k"   }, //   312: ĸ
+    { 0x0139, "l"   }, //   313: Ĺ
+    { 0x013a, "l"   }, //   314: ĺ
+    { 0x013b, "l"   }, //   315: Ļ
+    { 0x013c, "l"   }, //   316: ļ
+    { 0x013d, "l"   }, //   317: Ľ
+    { 0x013e, "l"   }, //   318: ľ
+    { 0x013f, "l"   }, //   319: Ŀ
+    { 0x0140, "l"   }, //   320: ŀ
+    { 0x0141, "l"   }, //   321: Ł
+    { 0x0142, "l"   }, //   322: ł
+    { 0x0143, "n"   }, //   323: Ń
+    { 0x0144, "n"   }, //   324: ń
+    { 0x0145, "n"   }, //   325: Ņ
+    { 0x0146, "n"   }, //   326: ņ
+    { 0x0147, "n"   }, //   327: Ň
+    { 0x0148, "n"   }, //   328: ň
+    { 0x0149, "n"   }, //   329: ŉ
+    { 0x014a, "ng"  }, //   330: Ŋ
+    { 0x014b, "ng"  }, //   331: ŋ
+    { 0x014c, "o"   }, //   332: Ō
+    { 0x014d, "o"   }, //   333: ō
+    { 0x014e, "o"   }, //   334: Ŏ
+    { 0x014f, "o"   }, //   335: ŏ
+    { 0x0150, "oe"  }, //   336: Ő
+    { 0x0151, "oe"  }, //   337: ő
+    { 0x0152, "oe"  }, //   338: Œ
+    { 0x0153, "oe"  }, //   339: œ
+    { 0x0154, "r"   }, //   340: Ŕ
+    { 0x0155, "r"   }, //   341: ŕ
+    { 0x0156, "r"   }, //   342: Ŗ
+    { 0x0157, "r"   }, //   343: ŗ
+    { 0x0158, "r"   }, //   344: Ř
+    { 0x0159, "r"   }, //   345: ř
+    { 0x015a, "s"   }, //   346: Ś
+    { 0x015b, "s"   }, //   347: ś
+    { 0x015c, "s"   }, //   348: Ŝ
+    { 0x015d, "s"   }, //   349: ŝ
+    { 0x015e, "s"   }, //   350: Ş
+    { 0x015f, "s"   }, //   351: ş
+    { 0x0160, "s"   }, //   352: Š
+    { 0x0161, "s"   }, //   353: š
+    { 0x0162, "t"   }, //   354: Ţ
+    { 0x0163, "t"   }, //   355: ţ
+    { 0x0164, "t"   }, //   356: Ť
+    { 0x0165, "t"   }, //   357: ť
+    { 0x0166, "t"   }, //   358: Ŧ
+    { 0x0167, "t"   }, //   359: ŧ
+    { 0x0168, "u"   }, //   360: Ũ
+    { 0x0169, "u"   }, //   361: ũ
+    { 0x016a, "u"   }, //   362: Ū
+    { 0x016b, "u"   }, //   363: ū
+    { 0x016c, "u"   }, //   364: Ŭ
+    { 0x016d, "u"   }, //   365: ŭ
+    { 0x016e, "u"   }, //   366: Ů
+    { 0x016f, "u"   }, //   367: ů
+    { 0x0170, "ue"  }, //   368: Ű
+    { 0x0171, "ue"  }, //   369: ű
+    { 0x0172, "u"   }, //   370: Ų
+    { 0x0173, "u"   }, //   371: ų
+    { 0x0174, "w"   }, //   372: Ŵ
+    { 0x0175, "w"   }, //   373: ŵ
+    { 0x0176, "y"   }, //   374: Ŷ
+    { 0x0177, "y"   }, //   375: ŷ
+    { 0x0178, "y"   }, //   376: Ÿ
+    { 0x0179, "z"   }, //   377: Ź
+    { 0x017a, "z"   }, //   378: ź
+    { 0x017b, "z"   }, //   379: Ż
+    { 0x017c, "z"   }, //   380: ż
+    { 0x017d, "z"   }, //   381: Ž
+    { 0x017e, "r"   }, //   382: ž
+    { 0x017f, "s"   }, //   383: ſ
+
+    // Latin Extended-B
+    { 0x0180, "b"   }, //   384: ƀ
+    { 0x0181, "b"   }, //   385: Ɓ
+    { 0x0182, "b"   }, //   386: Ƃ
+    { 0x0183, "b"   }, //   387: ƃ
+    { 0x0184, "h"   }, //   388: Ƅ
+    { 0x0185, "h"   }, //   389: ƅ
+    { 0x0186, "o"   }, //   390: Ɔ
+    { 0x0187, "c"   }, //   391: Ƈ
+    { 0x0188, "c"   }, //   392: ƈ
+    { 0x0189, "d"   }, //   393: Ɖ
+    { 0x018a, "d"   }, //   394: Ɗ
+    { 0x018b, "d"   }, //   395: Ƌ
+    { 0x018c, "d"   }, //   396: ƌ
+    { 0x018d, "s"   }, //   397: ƍ
+    { 0x018e, "e"   }, //   398: Ǝ
+    { 0x018f, "e"   }, //   399: Ə
+    { 0x0190, "e"   }, //   400: Ɛ
+    { 0x0191, "f"   }, //   401: Ƒ
+    { 0x0192, "f"   }, //   402: ƒ
+    { 0x0193, "g"   }, //   403: Ɠ
+    { 0x0194, "g"   }, //   404: Ɣ
+    { 0x0195, "hv"  }, //   405: ƕ
+    { 0x0196, "i"   }, //   406: Ɩ
+    { 0x0197, "i"   }, //   407: Ɨ
+    { 0x0198, "k"   }, //   408: Ƙ
+    { 0x0199, "k"   }, //   409: ƙ
+    { 0x019a, "l"   }, //   410: ƚ
+    { 0x019b, "l"   }, //   411: ƛ
+    { 0x019c, "m"   }, //   412: Ɯ
+    { 0x019d, "n"   }, //   413: Ɲ
+    { 0x019e, "n"   }, //   414: ƞ
+    { 0x019f, "o"   }, //   415: Ɵ
+    { 0x01a0, "o"   }, //   416: Ơ
+    { 0x01a1, "o"   }, //   417: ơ
+    { 0x01a2, "g"   }, //   418: Ƣ
+    { 0x01a3, "g"   }, //   419: ƣ
+    { 0x01a4, "p"   }, //   420: Ƥ
+    { 0x01a5, "p"   }, //   421: ƥ
+    { 0x01a6, "r"   }, //   422: Ʀ
+    { 0x01a7, "s"   }, //   423: Ƨ
+    { 0x01a8, "s"   }, //   424: ƨ
+    { 0x01a9, "s"   }, //   425: Ʃ
+    { 0x01aa, "t"   }, //   426: ƪ
+    { 0x01ab, "t"   }, //   427: ƫ
+    { 0x01ac, "t"   }, //   428: Ƭ
+    { 0x01ad, "t"   }, //   429: ƭ
+    { 0x01ae, "t"   }, //   430: Ʈ
+    { 0x01af, "u"   }, //   431: Ư
+    { 0x01b0, "u"   }, //   432: ư
+    { 0x01b1, "u"   }, //   433: Ʊ
+    { 0x01b2, "v"   }, //   434: Ʋ
+    { 0x01b3, "y"   }, //   435: Ƴ
+    { 0x01b4, "y"   }, //   436: ƴ
+    { 0x01b5, "z"   }, //   437: Ƶ
+    { 0x01b6, "z"   }, //   438: ƶ
+    { 0x01b7, "z"   }, //   439: Ʒ
+    { 0x01b8, "z"   }, //   440: Ƹ
+    { 0x01b9, "z"   }, //   441: ƹ
+    { 0x01ba, "z"   }, //   442: ƺ
+    { 0x01bb, "z"   }, //   443: ƻ
+    { 0x01bc, "q"   }, //   444: Ƽ
+    { 0x01bd, "q"   }, //   445: ƽ
+    { 0x01bf, "w"   }, //   447: ƿ
+    { 0x01c4, "dz"  }, //   452: Ǆ
+    { 0x01c5, "dz"  }, //   453: ǅ
+    { 0x01c6, "dz"  }, //   454: ǆ
+    { 0x01c7, "lj"  }, //   455: Ǉ
+    { 0x01c8, "lj"  }, //   456: ǈ
+    { 0x01c9, "lj"  }, //   457: ǉ
+    { 0x01ca, "nj"  }, //   458: Ǌ
+    { 0x01cb, "nj"  }, //   459: ǋ
+    { 0x01cc, "nj"  }, //   460: ǌ
+    { 0x01cd, "a"   }, //   461: Ǎ
+    { 0x01ce, "a"   }, //   462: ǎ
+    { 0x01cf, "i"   }, //   463: Ǐ
+    { 0x01d0, "i"   }, //   464: ǐ
+    { 0x01d1, "o"   }, //   465: Ǒ
+    { 0x01d2, "o"   }, //   466: ǒ
+    { 0x01d3, "u"   }, //   467: Ǔ
+    { 0x01d4, "u"   }, //   468: ǔ
+    { 0x01d5, "ue"  }, //   469: Ǖ
+    { 0x01d6, "ue"  }, //   470: ǖ
+    { 0x01d7, "ue"  }, //   471: Ǘ
+    { 0x01d8, "ue"  }, //   472: ǘ
+    { 0x01d9, "ue"  }, //   473: Ǚ
+    { 0x01da, "ue"  }, //   474: ǚ
+    { 0x01db, "ue"  }, //   475: Ǜ
+    { 0x01dc, "ue"  }, //   476: ǜ
+    { 0x01dd, "e"   }, //   477: ǝ
+    { 0x01de, "ae"  }, //   478: Ǟ
+    { 0x01df, "ae"  }, //   479: ǟ
+    { 0x01e0, "ae"  }, //   480: Ǡ
+    { 0x01e1, "ae"  }, //   481: ǡ
+    { 0x01e2, "ae"  }, //   482: Ǣ
+    { 0x01e3, "ae"  }, //   483: ǣ
+    { 0x01e4, "g"   }, //   484: Ǥ
+    { 0x01e5, "g"   }, //   485: ǥ
+    { 0x01e6, "g"   }, //   486: Ǧ
+    { 0x01e7, "g"   }, //   487: ǧ
+    { 0x01e8, "k"   }, //   488: Ǩ
+    { 0x01e9, "k"   }, //   489: ǩ
+    { 0x01ea, "o"   }, //   490: Ǫ
+    { 0x01eb, "o"   }, //   491: ǫ
+    { 0x01ec, "o"   }, //   492: Ǭ
+    { 0x01ed, "o"   }, //   493: ǭ
+    { 0x01ee, "z"   }, //   494: Ǯ
+    { 0x01ef, "z"   }, //   495: ǯ
+    { 0x01f0, "j"   }, //   496: ǰ
+    { 0x01f1, "dz"  }, //   497: Ǳ
+    { 0x01f2, "dz"  }, //   498: ǲ
+    { 0x01f3, "dz"  }, //   499: ǳ
+    { 0x01f4, "g"   }, //   500: Ǵ
+    { 0x01f5, "g"   }, //   501: ǵ
+    { 0x01f6, "hv"  }, //   502: Ƕ
+    { 0x01f7, "w"   }, //   503: Ƿ
+    { 0x01f8, "n"   }, //   504: Ǹ
+    { 0x01f9, "n"   }, //   505: ǹ
+    { 0x01fa, "a"   }, //   506: Ǻ
+    { 0x01fb, "a"   }, //   507: ǻ
+    { 0x01fc, "ae"  }, //   508: Ǽ
+    { 0x01fd, "ae"  }, //   509: ǽ
+    { 0x01fe, "oe"  }, //   510: Ǿ
+    { 0x01ff, "oe"  }, //   511: ǿ
+    { 0x0200, "ae"  }, //   512: Ȁ
+    { 0x0201, "ae"  }, //   513: ȁ
+    { 0x0202, "a"   }, //   514: Ȃ
+    { 0x0203, "a"   }, //   515: ȃ
+    { 0x0204, "e"   }, //   516: Ȅ
+    { 0x0205, "e"   }, //   517: ȅ
+    { 0x0206, "e"   }, //   518: Ȇ
+    { 0x0207, "e"   }, //   519: ȇ
+    { 0x0208, "i"   }, //   520: Ȉ
+    { 0x0209, "i"   }, //   521: ȉ
+    { 0x020a, "i"   }, //   522: Ȋ
+    { 0x020b, "i"   }, //   523: ȋ
+    { 0x020c, "oe"  }, //   524: Ȍ
+    { 0x020d, "oe"  }, //   525: ȍ
+    { 0x020e, "o"   }, //   526: Ȏ
+    { 0x020f, "o"   }, //   527: ȏ
+    { 0x0210, "r"   }, //   528: Ȑ
+    { 0x0211, "r"   }, //   529: ȑ
+    { 0x0212, "r"   }, //   530: Ȓ
+    { 0x0213, "r"   }, //   531: ȓ
+    { 0x0214, "ue"  }, //   532: Ȕ
+    { 0x0215, "ue"  }, //   533: ȕ
+    { 0x0216, "u"   }, //   534: Ȗ
+    { 0x0217, "u"   }, //   535: ȗ
+    { 0x0218, "s"   }, //   536: Ș
+    { 0x0219, "s"   }, //   537: ș
+    { 0x021a, "t"   }, //   538: Ț
+    { 0x021b, "t"   }, //   539: ț
+    { 0x021c, "g"   }, //   540: Ȝ
+    { 0x021d, "g"   }, //   541: ȝ
+    { 0x021e, "h"   }, //   542: Ȟ
+    { 0x021f, "h"   }, //   543: ȟ
+    { 0x0220, "n"   }, //   544: Ƞ
+    { 0x0221, "d"   }, //   545: ȡ
+    { 0x0222, "ou"  }, //   546: Ȣ
+    { 0x0223, "ou"  }, //   547: ȣ
+    { 0x0224, "z"   }, //   548: Ȥ
+    { 0x0225, "z"   }, //   549: ȥ
+    { 0x0226, "a"   }, //   550: Ȧ
+    { 0x0227, "a"   }, //   551: ȧ
+    { 0x0228, "e"   }, //   552: Ȩ
+    { 0x0229, "e"   }, //   553: ȩ
+    { 0x022a, "oe"  }, //   554: Ȫ
+    { 0x022b, "oe"  }, //   555: ȫ
+    { 0x022c, "o"   }, //   556: Ȭ
+    { 0x022d, "o"   }, //   557: ȭ
+    { 0x022e, "o"   }, //   558: Ȯ
+    { 0x022f, "o"   }, //   559: ȯ
+    { 0x0230, "o"   }, //   560: Ȱ
+    { 0x0231, "o"   }, //   561: ȱ
+    { 0x0232, "y"   }, //   562: Ȳ
+    { 0x0233, "y"   }, //   563: ȳ
+    { 0x0234, "l"   }, //   564: ȴ
+    { 0x0235, "n"   }, //   565: ȵ
+    { 0x0236, "t"   }, //   566: ȶ
+    { 0x0237, "j"   }, //   567: ȷ
+    { 0x0238, "db"  }, //   568: ȸ
+    { 0x0239, "qp"  }, //   569: ȹ
+    { 0x023a, "a"   }, //   570: Ⱥ
+    { 0x023b, "c"   }, //   571: Ȼ
+    { 0x023c, "c"   }, //   572: ȼ
+    { 0x023d, "l"   }, //   573: Ƚ
+    { 0x023e, "t"   }, //   574: Ⱦ
+    { 0x023f, "s"   }, //   575: ȿ
+    { 0x0240, "z"   }, //   576: ɀ
+    { 0x0243, "b"   }, //   579: Ƀ
+    { 0x0244, "u"   }, //   580: Ʉ
+    { 0x0245, "v"   }, //   581: Ʌ
+    { 0x0246, "e"   }, //   582: Ɇ
+    { 0x0247, "e"   }, //   583: ɇ
+    { 0x0248, "j"   }, //   584: Ɉ
+    { 0x0249, "j"   }, //   585: ɉ
+    { 0x024a, "q"   }, //   586: Ɋ
+    { 0x024b, "q"   }, //   587: ɋ
+    { 0x024c, "r"   }, //   588: Ɍ
+    { 0x024d, "r"   }, //   589: ɍ
+    { 0x024e, "y"   }, //   590: Ɏ
+    { 0x024f, "y"   }, //   591: ɏ
+
+    // Latin Extended Additional
+    { 0x1e00, "a"   }, //  7680: Ḁ
+    { 0x1e01, "a"   }, //  7681: ḁ
+    { 0x1e02, "b"   }, //  7682: Ḃ
+    { 0x1e03, "b"   }, //  7683: ḃ
+    { 0x1e04, "b"   }, //  7684: Ḅ
+    { 0x1e05, "b"   }, //  7685: ḅ
+    { 0x1e06, "b"   }, //  7686: Ḇ
+    { 0x1e07, "b"   }, //  7687: ḇ
+    { 0x1e08, "c"   }, //  7688: Ḉ
+    { 0x1e09, "c"   }, //  7689: ḉ
+    { 0x1e0a, "d"   }, //  7690: Ḋ
+    { 0x1e0b, "d"   }, //  7691: ḋ
+    { 0x1e0c, "d"   }, //  7692: Ḍ
+    { 0x1e0d, "d"   }, //  7693: ḍ
+    { 0x1e0e, "d"   }, //  7694: Ḏ
+    { 0x1e0f, "d"   }, //  7695: ḏ
+    { 0x1e10, "d"   }, //  7696: Ḑ
+    { 0x1e11, "d"   }, //  7697: ḑ
+    { 0x1e12, "d"   }, //  7698: Ḓ
+    { 0x1e13, "d"   }, //  7699: ḓ
+    { 0x1e14, "e"   }, //  7700: Ḕ
+    { 0x1e15, "e"   }, //  7701: ḕ
+    { 0x1e16, "e"   }, //  7702: Ḗ
+    { 0x1e17, "e"   }, //  7703: ḗ
+    { 0x1e18, "e"   }, //  7704: Ḙ
+    { 0x1e19, "e"   }, //  7705: ḙ
+    { 0x1e1a, "e"   }, //  7706: Ḛ
+    { 0x1e1b, "e"   }, //  7707: ḛ
+    { 0x1e1c, "e"   }, //  7708: Ḝ
+    { 0x1e1d, "e"   }, //  7709: ḝ
+    { 0x1e1e, "f"   }, //  7710: Ḟ
+    { 0x1e1f, "f"   }, //  7711: ḟ
+    { 0x1e20, "g"   }, //  7712: Ḡ
+    { 0x1e21, "g"   }, //  7713: ḡ
+    { 0x1e22, "h"   }, //  7714: Ḣ
+    { 0x1e23, "h"   }, //  7715: ḣ
+    { 0x1e24, "h"   }, //  7716: Ḥ
+    { 0x1e25, "h"   }, //  7717: ḥ
+    { 0x1e26, "h"   }, //  7718: Ḧ
+    { 0x1e27, "h"   }, //  7719: ḧ
+    { 0x1e28, "h"   }, //  7720: Ḩ
+    { 0x1e29, "h"   }, //  7721: ḩ
+    { 0x1e2a, "h"   }, //  7722: Ḫ
+    { 0x1e2b, "h"   }, //  7723: ḫ
+    { 0x1e2c, "i"   }, //  7724: Ḭ
+    { 0x1e2d, "i"   }, //  7725: ḭ
+    { 0x1e2e, "i"   }, //  7726: Ḯ
+    { 0x1e2f, "i"   }, //  7727: ḯ
+    { 0x1e30, "k"   }, //  7728: Ḱ
+    { 0x1e31, "k"   }, //  7729: ḱ
+    { 0x1e32, "k"   }, //  7730: Ḳ
+    { 0x1e33, "k"   }, //  7731: ḳ
+    { 0x1e34, "k"   }, //  7732: Ḵ
+    { 0x1e35, "k"   }, //  7733: ḵ
+    { 0x1e36, "l"   }, //  7734: Ḷ
+    { 0x1e37, "l"   }, //  7735: ḷ
+    { 0x1e38, "l"   }, //  7736: Ḹ
+    { 0x1e39, "l"   }, //  7737: ḹ
+    { 0x1e3a, "l"   }, //  7738: Ḻ
+    { 0x1e3b, "l"   }, //  7739: ḻ
+    { 0x1e3c, "l"   }, //  7740: Ḽ
+    { 0x1e3d, "l"   }, //  7741: ḽ
+    { 0x1e3e, "m"   }, //  7742: Ḿ
+    { 0x1e3f, "m"   }, //  7743: ḿ
+    { 0x1e40, "m"   }, //  7744: Ṁ
+    { 0x1e41, "m"   }, //  7745: ṁ
+    { 0x1e42, "m"   }, //  7746: Ṃ
+    { 0x1e43, "m"   }, //  7747: ṃ
+    { 0x1e44, "n"   }, //  7748: Ṅ
+    { 0x1e45, "n"   }, //  7749: ṅ
+    { 0x1e46, "n"   }, //  7750: Ṇ
+    { 0x1e47, "n"   }, //  7751: ṇ
+    { 0x1e48, "n"   }, //  7752: Ṉ
+    { 0x1e49, "n"   }, //  7753: ṉ
+    { 0x1e4a, "n"   }, //  7754: Ṋ
+    { 0x1e4b, "n"   }, //  7755: ṋ
+    { 0x1e4c, "o"   }, //  7756: Ṍ
+    { 0x1e4d, "o"   }, //  7757: ṍ
+    { 0x1e4e, "oe"  }, //  7758: Ṏ
+    { 0x1e4f, "oe"  }, //  7759: ṏ
+    { 0x1e50, "o"   }, //  7760: Ṑ
+    { 0x1e51, "o"   }, //  7761: ṑ
+    { 0x1e52, "o"   }, //  7762: Ṓ
+    { 0x1e53, "o"   }, //  7763: ṓ
+    { 0x1e54, "p"   }, //  7764: Ṕ
+    { 0x1e55, "p"   }, //  7765: ṕ
+    { 0x1e56, "p"   }, //  7766: Ṗ
+    { 0x1e57, "p"   }, //  7767: ṗ
+    { 0x1e58, "r"   }, //  7768: Ṙ
+    { 0x1e59, "r"   }, //  7769: ṙ
+    { 0x1e5a, "r"   }, //  7770: Ṛ
+    { 0x1e5b, "r"   }, //  7771: ṛ
+    { 0x1e5c, "r"   }, //  7772: Ṝ
+    { 0x1e5d, "r"   }, //  7773: ṝ
+    { 0x1e5e, "r"   }, //  7774: Ṟ
+    { 0x1e5f, "r"   }, //  7775: ṟ
+    { 0x1e60, "s"   }, //  7776: Ṡ
+    { 0x1e61, "s"   }, //  7777: ṡ
+    { 0x1e62, "s"   }, //  7778: Ṣ
+    { 0x1e63, "s"   }, //  7779: ṣ
+    { 0x1e64, "s"   }, //  7780: Ṥ
+    { 0x1e65, "s"   }, //  7781: ṥ
+    { 0x1e66, "s"   }, //  7782: Ṧ
+    { 0x1e67, "s"   }, //  7783: ṧ
+    { 0x1e68, "s"   }, //  7784: Ṩ
+    { 0x1e69, "s"   }, //  7785: ṩ
+    { 0x1e6a, "t"   }, //  7786: Ṫ
+    { 0x1e6b, "t"   }, //  7787: ṫ
+    { 0x1e6c, "t"   }, //  7788: Ṭ
+    { 0x1e6d, "t"   }, //  7789: ṭ
+    { 0x1e6e, "t"   }, //  7790: Ṯ
+    { 0x1e6f, "t"   }, //  7791: ṯ
+    { 0x1e70, "t"   }, //  7792: Ṱ
+    { 0x1e71, "t"   }, //  7793: ṱ
+    { 0x1e72, "u"   }, //  7794: Ṳ
+    { 0x1e73, "u"   }, //  7795: ṳ
+    { 0x1e74, "u"   }, //  7796: Ṵ
+    { 0x1e75, "u"   }, //  7797: ṵ
+    { 0x1e76, "u"   }, //  7798: Ṷ
+    { 0x1e77, "u"   }, //  7799: ṷ
+    { 0x1e78, "u"   }, //  7800: Ṹ
+    { 0x1e79, "u"   }, //  7801: ṹ
+    { 0x1e7a, "ue"  }, //  7802: Ṻ
+    { 0x1e7b, "ue"  }, //  7803: ṻ
+    { 0x1e7c, "v"   }, //  7804: Ṽ
+    { 0x1e7d, "v"   }, //  7805: ṽ
+    { 0x1e7e, "v"   }, //  7806: Ṿ
+    { 0x1e7f, "v"   }, //  7807: ṿ
+    { 0x1e80, "w"   }, //  7808: Ẁ
+    { 0x1e81, "w"   }, //  7809: ẁ
+    { 0x1e82, "w"   }, //  7810: Ẃ
+    { 0x1e83, "w"   }, //  7811: ẃ
+    { 0x1e84, "w"   }, //  7812: Ẅ
+    { 0x1e85, "w"   }, //  7813: ẅ
+    { 0x1e86, "w"   }, //  7814: Ẇ
+    { 0x1e87, "w"   }, //  7815: ẇ
+    { 0x1e88, "w"   }, //  7816: Ẉ
+    { 0x1e89, "w"   }, //  7817: ẉ
+    { 0x1e8a, "x"   }, //  7818: Ẋ
+    { 0x1e8b, "x"   }, //  7819: ẋ
+    { 0x1e8c, "x"   }, //  7820: Ẍ
+    { 0x1e8d, "x"   }, //  7821: ẍ
+    { 0x1e8e, "y"   }, //  7822: Ẏ
+    { 0x1e8f, "y"   }, //  7823: ẏ
+    { 0x1e90, "z"   }, //  7824: Ẑ
+    { 0x1e91, "z"   }, //  7825: ẑ
+    { 0x1e92, "z"   }, //  7826: Ẓ
+    { 0x1e93, "z"   }, //  7827: ẓ
+    { 0x1e94, "z"   }, //  7828: Ẕ
+    { 0x1e95, "z"   }, //  7829: ẕ
+    { 0x1e96, "h"   }, //  7830: ẖ
+    { 0x1e97, "t"   }, //  7831: ẗ
+    { 0x1e98, "w"   }, //  7832: ẘ
+    { 0x1e99, "y"   }, //  7833: ẙ
+    { 0x1e9a, "a"   }, //  7834: ẚ
+    { 0x1e9b, "s"   }, //  7835: ẛ
+    { 0x1e9c, "s"   }, //  7836: ẜ
+    { 0x1e9d, "s"   }, //  7837: ẝ
+    { 0x1e9e, "ss"  }, //  7838: ẞ
+    { 0x1e9f, "d"   }, //  7839: ẟ
+    { 0x1ea0, "a"   }, //  7840: Ạ
+    { 0x1ea1, "a"   }, //  7841: ạ
+    { 0x1ea2, "a"   }, //  7842: Ả
+    { 0x1ea3, "a"   }, //  7843: ả
+    { 0x1ea4, "a"   }, //  7844: Ấ
+    { 0x1ea5, "a"   }, //  7845: ấ
+    { 0x1ea6, "a"   }, //  7846: Ầ
+    { 0x1ea7, "a"   }, //  7847: ầ
+    { 0x1ea8, "a"   }, //  7848: Ẩ
+    { 0x1ea9, "a"   }, //  7849: ẩ
+    { 0x1eaa, "a"   }, //  7850: Ẫ
+    { 0x1eab, "a"   }, //  7851: ẫ
+    { 0x1eac, "a"   }, //  7852: Ậ
+    { 0x1ead, "a"   }, //  7853: ậ
+    { 0x1eae, "a"   }, //  7854: Ắ
+    { 0x1eaf, "a"   }, //  7855: ắ
+    { 0x1eb0, "a"   }, //  7856: Ằ
+    { 0x1eb1, "a"   }, //  7857: ằ
+    { 0x1eb2, "a"   }, //  7858: Ẳ
+    { 0x1eb3, "a"   }, //  7859: ẳ
+    { 0x1eb4, "a"   }, //  7860: Ẵ
+    { 0x1eb5, "a"   }, //  7861: ẵ
+    { 0x1eb6, "a"   }, //  7862: Ặ
+    { 0x1eb7, "a"   }, //  7863: ặ
+    { 0x1eb8, "e"   }, //  7864: Ẹ
+    { 0x1eb9, "e"   }, //  7865: ẹ
+    { 0x1eba, "e"   }, //  7866: Ẻ
+    { 0x1ebb, "e"   }, //  7867: ẻ
+    { 0x1ebc, "e"   }, //  7868: Ẽ
+    { 0x1ebd, "e"   }, //  7869: ẽ
+    { 0x1ebe, "e"   }, //  7870: Ế
+    { 0x1ebf, "e"   }, //  7871: ế
+    { 0x1ec0, "e"   }, //  7872: Ề
+    { 0x1ec1, "e"   }, //  7873: ề
+    { 0x1ec2, "e"   }, //  7874: Ể
+    { 0x1ec3, "e"   }, //  7875: ể
+    { 0x1ec4, "e"   }, //  7876: Ễ
+    { 0x1ec5, "e"   }, //  7877: ễ
+    { 0x1ec6, "e"   }, //  7878: Ệ
+    { 0x1ec7, "e"   }, //  7879: ệ
+    { 0x1ec8, "i"   }, //  7880: Ỉ
+    { 0x1ec9, "i"   }, //  7881: ỉ
+    { 0x1eca, "i"   }, //  7882: Ị
+    { 0x1ecb, "i"   }, //  7883: ị
+    { 0x1ecc, "o"   }, //  7884: Ọ
+    { 0x1ecd, "o"   }, //  7885: ọ
+    { 0x1ece, "o"   }, //  7886: Ỏ
+    { 0x1ecf, "o"   }, //  7887: ỏ
+    { 0x1ed0, "o"   }, //  7888: Ố
+    { 0x1ed1, "o"   }, //  7889: ố
+    { 0x1ed2, "o"   }, //  7890: Ồ
+    { 0x1ed3, "o"   }, //  7891: ồ
+    { 0x1ed4, "o"   }, //  7892: Ổ
+    { 0x1ed5, "o"   }, //  7893: ổ
+    { 0x1ed6, "o"   }, //  7894: Ỗ
+    { 0x1ed7, "o"   }, //  7895: ỗ
+    { 0x1ed8, "o"   }, //  7896: Ộ
+    { 0x1ed9, "o"   }, //  7897: ộ
+    { 0x1eda, "o"   }, //  7898: Ớ
+    { 0x1edb, "o"   }, //  7899: ớ
+    { 0x1edc, "o"   }, //  7900: Ờ
+    { 0x1edd, "o"   }, //  7901: ờ
+    { 0x1ede, "o"   }, //  7902: Ở
+    { 0x1edf, "o"   }, //  7903: ở
+    { 0x1ee0, "o"   }, //  7904: Ỡ
+    { 0x1ee1, "o"   }, //  7905: ỡ
+    { 0x1ee2, "o"   }, //  7906: Ợ
+    { 0x1ee3, "o"   }, //  7907: ợ
+    { 0x1ee4, "u"   }, //  7908: Ụ
+    { 0x1ee5, "u"   }, //  7909: ụ
+    { 0x1ee6, "u"   }, //  7910: Ủ
+    { 0x1ee7, "u"   }, //  7911: ủ
+    { 0x1ee8, "u"   }, //  7912: Ứ
+    { 0x1ee9, "u"   }, //  7913: ứ
+    { 0x1eea, "u"   }, //  7914: Ừ
+    { 0x1eeb, "u"   }, //  7915: ừ
+    { 0x1eec, "u"   }, //  7916: Ử
+    { 0x1eed, "u"   }, //  7917: ử
+    { 0x1eee, "u"   }, //  7918: Ữ
+    { 0x1eef, "u"   }, //  7919: ữ
+    { 0x1ef0, "u"   }, //  7920: Ự
+    { 0x1ef1, "u"   }, //  7921: ự
+    { 0x1ef2, "y"   }, //  7922: Ỳ
+    { 0x1ef3, "y"   }, //  7923: ỳ
+    { 0x1ef4, "y"   }, //  7924: Ỵ
+    { 0x1ef5, "y"   }, //  7925: ỵ
+    { 0x1ef6, "y"   }, //  7926: Ỷ
+    { 0x1ef7, "y"   }, //  7927: ỷ
+    { 0x1ef8, "y"   }, //  7928: Ỹ
+    { 0x1ef9, "y"   }, //  7929: ỹ
+    { 0x1efa, "li"  }, //  7930: Ỻ
+    { 0x1efb, "li"  }, //  7931: ỻ
+    { 0x1efc, "v"   }, //  7932: Ỽ
+    { 0x1efd, "v"   }, //  7933: ỽ
+    { 0x1efe, "y"   }, //  7934: Ỿ
+    { 0x1eff, "y"   }, //  7935: ỿ
+
+    // Currency Symbols
+    { 0x20ac, "eur" }, //  8364: €
+
+    // Latin Extended-C
+    { 0x2c60, "l"   }, // 11360: Ⱡ
+    { 0x2c61, "i"   }, // 11361: ⱡ
+    { 0x2c62, "l"   }, // 11362: Ɫ
+    { 0x2c63, "p"   }, // 11363: Ᵽ
+    { 0x2c64, "r"   }, // 11364: Ɽ
+    { 0x2c65, "a"   }, // 11365: ⱥ
+    { 0x2c66, "t"   }, // 11366: ⱦ
+    { 0x2c67, "h"   }, // 11367: Ⱨ
+    { 0x2c68, "h"   }, // 11368: ⱨ
+    { 0x2c69, "k"   }, // 11369: Ⱪ
+    { 0x2c6a, "k"   }, // 11370: ⱪ
+    { 0x2c6b, "z"   }, // 11371: Ⱬ
+    { 0x2c6c, "z"   }, // 11372: ⱬ
+    { 0x2c6d, "a"   }, // 11373: Ɑ
+    { 0x2c6e, "m"   }, // 11374: Ɱ
+    { 0x2c6f, "a"   }, // 11375: Ɐ
+    { 0x2c70, "a"   }, // 11376: Ɒ
+    { 0x2c71, "v"   }, // 11377: ⱱ
+    { 0x2c72, "w"   }, // 11378: Ⱳ
+    { 0x2c73, "w"   }, // 11379: ⱳ
+    { 0x2c74, "v"   }, // 11380: ⱴ
+    { 0x2c75, "h"   }, // 11381: Ⱶ
+    { 0x2c76, "h"   }, // 11382: ⱶ
+    { 0x2c77, "ph"  }, // 11383: ⱷ
+    { 0x2c78, "e"   }, // 11384: ⱸ
+    { 0x2c79, "r"   }, // 11385: ⱹ
+    { 0x2c7a, "o"   }, // 11386: ⱺ
+    { 0x2c7b, "e"   }, // 11387: ⱻ
+    { 0x2c7c, "j"   }, // 11388: ⱼ
+    { 0x2c7d, "v"   }, // 11389: ⱽ
+    { 0x2c7e, "s"   }, // 11390: Ȿ
+    { 0x2c7f, "z"   }, // 11391: Ɀ
+
+    // Latin Extended-D
+    { 0xa726, "h"   }, // 42790: Ꜧ
+    { 0xa727, "h"   }, // 42791: ꜧ
+    { 0xa728, "tz"  }, // 42792: Ꜩ
+    { 0xa729, "tz"  }, // 42793: ꜩ
+    { 0xa730, "f"   }, // 42800: ꜰ
+    { 0xa731, "s"   }, // 42801: ꜱ
+    { 0xa732, "AA"  }, // 42802: Ꜳ
+    { 0xa733, "aa"  }, // 42803: ꜳ
+    { 0xa734, "ao"  }, // 42804: Ꜵ
+    { 0xa735, "ao"  }, // 42805: ꜵ
+    { 0xa736, "au"  }, // 42806: Ꜷ
+    { 0xa737, "au"  }, // 42807: ꜷ
+    { 0xa738, "av"  }, // 42808: Ꜹ
+    { 0xa739, "av"  }, // 42809: ꜹ
+    { 0xa73a, "av"  }, // 42810: Ꜻ
+    { 0xa73b, "av"  }, // 42811: ꜻ
+    { 0xa73c, "ay"  }, // 42812: Ꜽ
+    { 0xa73d, "ay"  }, // 42813: ꜽ
+    { 0xa73e, "c"   }, // 42814: Ꜿ
+    { 0xa73f, "c"   }, // 42815: ꜿ
+    { 0xa740, "k"   }, // 42816: Ꝁ
+    { 0xa741, "k"   }, // 42817: ꝁ
+    { 0xa742, "k"   }, // 42818: Ꝃ
+    { 0xa743, "k"   }, // 42819: ꝃ
+    { 0xa744, "k"   }, // 42820: Ꝅ
+    { 0xa745, "k"   }, // 42821: ꝅ
+    { 0xa746, "l"   }, // 42822: Ꝇ
+    { 0xa747, "l"   }, // 42823: ꝇ
+    { 0xa748, "l"   }, // 42824: Ꝉ
+    { 0xa749, "l"   }, // 42825: ꝉ
+    { 0xa74a, "o"   }, // 42826: Ꝋ
+    { 0xa74b, "o"   }, // 42827: ꝋ
+    { 0xa74c, "o"   }, // 42828: Ꝍ
+    { 0xa74d, "o"   }, // 42829: ꝍ
+    { 0xa74e, "oo"  }, // 42830: Ꝏ
+    { 0xa74f, "oo"  }, // 42831: ꝏ
+    { 0xa750, "p"   }, // 42832: Ꝑ
+    { 0xa751, "p"   }, // 42833: ꝑ
+    { 0xa752, "p"   }, // 42834: Ꝓ
+    { 0xa753, "p"   }, // 42835: ꝓ
+    { 0xa754, "p"   }, // 42836: Ꝕ
+    { 0xa755, "p"   }, // 42837: ꝕ
+    { 0xa756, "q"   }, // 42838: Ꝗ
+    { 0xa757, "q"   }, // 42839: ꝗ
+    { 0xa758, "q"   }, // 42840: Ꝙ
+    { 0xa759, "q"   }, // 42841: ꝙ
+    { 0xa75a, "r"   }, // 42842: Ꝛ
+    { 0xa75b, "r"   }, // 42843: ꝛ
+    { 0xa75e, "v"   }, // 42846: Ꝟ
+    { 0xa75f, "v"   }, // 42847: ꝟ
+    { 0xa760, "vy"  }, // 42848: Ꝡ
+    { 0xa761, "vy"  }, // 42849: ꝡ
+    { 0xa762, "z"   }, // 42850: Ꝣ
+    { 0xa763, "z"   }, // 42851: ꝣ
+    { 0xa764, "th"  }, // 42852: Ꝥ
+    { 0xa765, "th"  }, // 42853: ꝥ
+    { 0xa766, "th"  }, // 42854: Ꝧ
+    { 0xa767, "th"  }, // 42855: ꝧ
+    { 0xa768, "v"   }, // 42856: Ꝩ
+    { 0xa769, "v"   }, // 42857: ꝩ
+    { 0xa76e, "9"   }, // 42862: Ꝯ
+    { 0xa76f, "9"   }, // 42863: ꝯ
+    { 0xa770, "9"   }, // 42864: ꝰ
+    { 0xa771, "d"   }, // 42865: ꝱ
+    { 0xa772, "l"   }, // 42866: ꝲ
+    { 0xa773, "m"   }, // 42867: ꝳ
+    { 0xa774, "n"   }, // 42868: ꝴ
+    { 0xa775, "r"   }, // 42869: ꝵ
+    { 0xa776, "r"   }, // 42870: ꝶ
+    { 0xa777, "t"   }, // 42871: ꝷ
+    { 0xa779, "d"   }, // 42873: Ꝺ
+    { 0xa77a, "d"   }, // 42874: ꝺ
+    { 0xa77b, "f"   }, // 42875: Ꝼ
+    { 0xa77c, "f"   }, // 42876: ꝼ
+    { 0xa77d, "g"   }, // 42877: Ᵹ
+    { 0xa77e, "g"   }, // 42878: Ꝿ
+    { 0xa77f, "g"   }, // 42879: ꝿ
+    { 0xa780, "l"   }, // 42880: Ꞁ
+    { 0xa781, "l"   }, // 42881: ꞁ
+    { 0xa782, "r"   }, // 42882: Ꞃ
+    { 0xa783, "r"   }, // 42883: ꞃ
+    { 0xa784, "s"   }, // 42884: Ꞅ
+    { 0xa785, "s"   }, // 42885: ꞅ
+    { 0xa786, "t"   }, // 42886: Ꞇ
+    { 0xa787, "t"   }, // 42887: ꞇ
+    { 0xa78d, "h"   }, // 42893: Ɥ
+    { 0xa78e, "l"   }, // 42894: ꞎ
+    { 0xa790, "n"   }, // 42896: Ꞑ
+    { 0xa791, "n"   }, // 42897: ꞑ
+    { 0xa792, "c"   }, // 42898: Ꞓ
+    { 0xa7a0, "g"   }, // 42912: Ꞡ
+    { 0xa7a1, "g"   }, // 42913: ꞡ
+    { 0xa7a2, "k"   }, // 42914: Ꞣ
+    { 0xa7a3, "k"   }, // 42915: ꞣ
+    { 0xa7a4, "n"   }, // 42916: Ꞥ
+    { 0xa7a5, "n"   }, // 42917: ꞥ
+    { 0xa7a6, "r"   }, // 42918: Ꞧ
+    { 0xa7a7, "r"   }, // 42919: ꞧ
+    { 0xa7a8, "s"   }, // 42920: Ꞩ
+    { 0xa7a9, "s"   }, // 42921: ꞩ
+    { 0xa7aa, "h"   }, // 42922: Ɦ
+    { 0xa7f8, "h"   }, // 43000: ꟸ
+    { 0xa7f9, "oe"  }, // 43001: ꟹ
+    { 0xa7fa, "m"   }, // 43002: ꟺ
+    { 0xa7fb, "f"   }, // 43003: ꟻ
+    { 0xa7fc, "p"   }, // 43004: ꟼ
+    { 0xa7fd, "m"   }, // 43005: ꟽ
+    { 0xa7fe, "i"   }, // 43006: ꟾ
+    { 0xa7ff, "m"   }  // 43007: ꟿ
+  };
+
+  /// number of transliterations
+  constexpr unsigned mappingCount = sizeof(mappings) / sizeof(mappings[0]);
+
+  /// number of code points per page
+  constexpr unsigned pageSize = 256;
+
+  /// number of pages in the Basic Multilingual Plane
+  constexpr unsigned planeSize = 0x10000 / pageSize;
+
+  /// maximum size of a replacement
+  constexpr unsigned maxTextSize = 3;
+
+
+  // -----
+  // Entry
+  // -----
+  /**
+   * @brief  A replacement stored inline (size 0: no transliteration).
+   */
+  struct Entry
+  {
+    /// the replacement (not terminated)
+    char text[maxTextSize];
+
+    /// the number of characters in text
+    unsigned char size;
+  };
+
+  // ---------
+  // textSize
+  // ---------
+  /**
+   * @brief  This function returns the length of a replacement.
+   */
+  constexpr unsigned textSize(const char* text)
+  {
+    unsigned size = 0;
+
+    while (text[size] != 0) size++;
+
+    return size;
+  }
+
+  // ----------
+  // countPages
+  // ----------
+  /**
+   * @brief  This function returns the number of pages the table needs.
+   */
+  constexpr unsigned countPages()
+  {
+    // page 0 is shared by all code points without transliteration
+    unsigned count = 1;
+
+    for(unsigned i = 0; i < mappingCount; i++)
+    {
+      if ( (i == 0) || ((mappings[i].code / pageSize) != (mappings[i - 1].code / pageSize)) )
+      {
+        count++;
+      }
+    }
+
+    return count;
+  }
+
+  /// number of pages used by the table
+  constexpr unsigned pageCount = countPages();
+
+  // -----
+  // Table
+  // -----
+  /**
+   * @brief  A two-level page table for the Basic Multilingual Plane.
+   */
+  struct Table
+  {
+    /// the page of each block of 256 code points
+    unsigned char index[planeSize];
+
+    /// the replacements
+    Entry pages[pageCount][pageSize];
+  };
+
+  // ---------
+  // makeTable
+  // ---------
+  /**
+   * @brief  This function fills the page table.
+   */
+  constexpr Table makeTable()
+  {
+    Table table = {};
+
+    // the current page
+    unsigned page = 0;
+
+    for(unsigned i = 0; i < mappingCount; i++)
+    {
+      // get mapping
+      const Mapping& m = mappings[i];
+
+      // start next page
+      if ( (i == 0) || ((m.code / pageSize) != (mappings[i - 1].code / pageSize)) )
+      {
+        page++;
+        table.index[m.code / pageSize] = page;
+      }
+
+      // get entry
+      Entry& e = table.pages[page][m.code % pageSize];
+
+      // copy replacement
+      e.size = textSize(m.text);
+      for(unsigned n = 0; n < e.size; n++) e.text[n] = m.text[n];
+    }
+
+    return table;
+  }
+
+  // --------
+  // validate
+  // --------
+  /**
+   * @brief  This function checks the list of transliterations.
+   */
+  constexpr bool validate()
+  {
+    for(unsigned i = 0; i < mappingCount; i++)
+    {
+      // check range
+      if (mappings[i].code >= planeSize * pageSize) return false;
+
+      // check order
+      if ( (i > 0) && (mappings[i - 1].code >= mappings[i].code) ) return false;
+
+      // check size
+      unsigned size = textSize(mappings[i].text);
+      if ( (size == 0) || (size > maxTextSize) ) return false;
+
+      // underscores are reserved for separators
+      for(unsigned n = 0; n < size; n++)
+      {
+        if (mappings[i].text[n] == '_') return false;
+      }
+    }
+
+    return true;
+  }
+
+  static_assert(validate(), "translit::mappings must be sorted and valid");
+  static_assert(pageCount <= 256, "translit::Table needs too many pages");
+
+  /// the page table (created at compile time)
+  constexpr Table table = makeTable();
+
+
+  // --------
+  // filename
+  // --------
+  /*
+   *
+   */
+  bool filename(const string& utf8, string& out)
+  {
+    // reset return value
+    out.clear();
+    out.reserve( utf8.size() );
+
+    // insert separator or not
+    bool separate = false;
+
+    // the input
+    const unsigned char* p   = reinterpret_cast<const unsigned char*>( utf8.data() );
+    const unsigned char* end = p + utf8.size();
+
+    while (p < end)
+    {
+      // get first byte
+      unsigned code = *p;
+
+      // ascii fast path: copy runs of lower case letters and digits
+      if ( ((code >= 'a') && (code <= 'z')) || ((code >= '0') && (code <= '9')) )
+      {
+        // find end of run
+        const unsigned char* q = p + 1;
+        while ( (q < end) && (((*q >= 'a') && (*q <= 'z')) || ((*q >= '0') && (*q <= '9'))) ) q++;
+
+        // add separator first (but don't start with one)
+        if ( separate && !out.empty() ) out += '_';
+        separate = false;
+
+        // copy run
+        out.append(reinterpret_cast<const char*>(p), q - p);
+
+        // continue after run
+        p = q;
+        continue;
+      }
+
+      // number of bytes to come
+      unsigned expected = 0;
+
+      // 0xxxxxxx
+      if (code < 0x80) expected = 0;
+
+      // 110xxxxx
+      else if ((code & 0xe0) == 0xc0) { code &= 0x1f; expected = 1; }
+
+      // 1110xxxx
+      else if ((code & 0xf0) == 0xe0) { code &= 0x0f; expected = 2; }
+
+      // 11110xxx
+      else if ((code & 0xf8) == 0xf0) { code &= 0x07; expected = 3; }
+
+      // invalid encoding
+      else return false;
+
+      // skip first byte
+      p++;
+
+      // 10xxxxxx
+      for(; expected > 0; expected--, p++)
+      {
+        // invalid encoding
+        if ( (p == end) || ((*p & 0xc0) != 0x80) ) return false;
+
+        // add current part
+        code = (code << 6) | (*p & 0x3f);
+      }
+
+      // get entry (code points beyond the table have no transliteration)
+      const Entry& e = table.pages[ (code < planeSize * pageSize) ? table.index[code / pageSize] : 0 ][ code % pageSize ];
+
+      // no transliteration
+      if (e.size == 0)
+      {
+        // set flag
+        separate = true;
+      }
+
+      // append replacement
+      else
+      {
+        // add separator first (but don't start with one)
+        if ( separate && !out.empty() ) out += '_';
+        separate = false;
+
+        // copy replacement
+        out.append(e.text, e.size);
+      }
+    }
+
+    // signalize success
+    return true;
+  }
+
+}
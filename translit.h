@@ -0,0 +1,56 @@
+// -----------------------------------------------------------------------------
+// translit.h                                                         translit.h
+// -----------------------------------------------------------------------------
+/**
+ * @file
+ * @brief      This file declares 'public' members of the @ref translit namespace.
+ * @author     Col. Walter E. Kurtz
+ * @version    2026-10-17
+ * @copyright  GNU General Public License - Version 3.0
+ */
+
+// -----------------------------------------------------------------------------
+// One-Definition-Rule                                       One-Definition-Rule
+// -----------------------------------------------------------------------------
+#ifndef TRANSLIT_H_INCLUDE_NO1
+#define TRANSLIT_H_INCLUDE_NO1
+
+
+// -----------------------------------------------------------------------------
+// Includes                                                             Includes
+// -----------------------------------------------------------------------------
+#include <string>
+
+
+// --------
+// translit
+// --------
+/**
+ * @brief  The @a translit namespace converts utf8 encoded text into
+ *         filesystem compliant ascii text.
+ */
+namespace translit
+{
+
+  // --------
+  // filename
+  // --------
+  /**
+   * @brief  This function creates a filename from the given text.
+   *
+   * Every character is replaced by its ascii transliteration. Characters
+   * without transliteration become separators; runs of separators are
+   * squeezed into a single underscore and removed at the beginning and
+   * at the end of the result.
+   *
+   * @param[in]  utf8  utf8 encoded text
+   * @param[out] out   the filename
+   *
+   * @return  false if the text isn't valid UTF-8
+   */
+  bool filename(const std::string& utf8, std::string& out);
+
+}
+
+#endif  /* #ifndef TRANSLIT_H_INCLUDE_NO1 */
+
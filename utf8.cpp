@@ -12,6 +12,7 @@
 // -----------------------------------------------------------------------------
 // Includes                                                             Includes
 // -----------------------------------------------------------------------------
+#include <cstring>
 #include <sstream>
 #include <iomanip>
 #include "utf8.h"
@@ -569,5 +570,24 @@ namespace utf8
     return false;
   }
 
+  // ------------
+  // collationKey
+  // ------------
+  /*
+   *
+   */
+  string collationKey(const string& utf8)
+  {
+    // get size of the key
+    size_t size = strxfrm(0, utf8.c_str(), 0);
+
+    // get key
+    string key(size + 1, '\0');
+    strxfrm(&key[0], utf8.c_str(), key.size());
+    key.resize(size);
+
+    return key;
+  }
+
 }
 
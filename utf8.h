@@ -94,6 +94,17 @@ namespace utf8
    */
   bool isLatinGraphical(unsigned unicode);
 
+  // ------------
+  // collationKey
+  // ------------
+  /**
+   * @param utf8  utf8 encoded string
+   *
+   * @return  the key that compares byte by byte like the given string
+   *          compares by the collation of the current locale (LC_COLLATE)
+   */
+  std::string collationKey(const std::string& utf8);
+
 }
 
 #endif  /* #ifndef UTF8_H_INCLUDE_NO1 */